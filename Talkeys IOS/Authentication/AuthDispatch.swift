@@ -0,0 +1,134 @@
+import Foundation
+
+// MARK: - Auth Dispatch
+/// Where auth work runs: keychain, database and sharedKit calls on one IO queue, UI state on the
+/// main actor. A flow does its IO off main and hops to the main actor once, at the end.
+enum AuthDispatch {
+    static let ioQueue = DispatchQueue(label: "AuthIO", qos: .userInitiated, attributes: .concurrent)
+
+    /// Run blocking work (keychain, SQLite, UserDefaults) on the IO queue
+    static func io<T>(_ body: @escaping () -> T) async -> T {
+        await withCheckedContinuation { continuation in
+            ioQueue.async {
+                continuation.resume(returning: body())
+            }
+        }
+    }
+
+    static func io<T>(_ body: @escaping () throws -> T) async throws -> T {
+        try await withCheckedThrowingContinuation { continuation in
+            ioQueue.async {
+                continuation.resume(with: Result { try body() })
+            }
+        }
+    }
+}
+
+// MARK: - Auth Flow Trace
+/// Records the thread each step of one auth flow ran on and counts main/background switches.
+/// Steps are marked from whatever thread the flow is on; `finish()` logs and aggregates the trace.
+final class AuthFlowTrace {
+    struct Step {
+        let name: String
+        let onMain: Bool
+        /// Seconds since the trace started
+        let elapsed: TimeInterval
+    }
+
+    let flow: String
+    private let start = CFAbsoluteTimeGetCurrent()
+    private let lock = NSLock()
+    private var recorded: [Step] = []
+
+    init(_ flow: String) {
+        self.flow = flow
+        mark("start")
+    }
+
+    func mark(_ name: String) {
+        let step = Step(name: name, onMain: pthread_main_np() != 0, elapsed: CFAbsoluteTimeGetCurrent() - start)
+        lock.lock()
+        recorded.append(step)
+        lock.unlock()
+    }
+
+    var steps: [Step] {
+        lock.lock()
+        defer { lock.unlock() }
+        return recorded
+    }
+
+    /// Switches between main and background threads across consecutive steps
+    var hops: Int {
+        let steps = self.steps
+        return zip(steps, steps.dropFirst()).filter { $0.onMain != $1.onMain }.count
+    }
+
+    /// Switches onto the main thread
+    var mainHops: Int {
+        let steps = self.steps
+        return zip(steps, steps.dropFirst()).filter { !$0.onMain && $1.onMain }.count
+    }
+
+    func finish(_ metrics: AuthFlowMetrics = .shared) {
+        mark("finish")
+        metrics.record(self)
+        let path = steps.map { "\($0.name)@\($0.onMain ? "main" : "bg")" }.joined(separator: " → ")
+        print("🧵 \(flow): \(hops) thread hops (\(mainHops) to main) in \(String(format: "%.1f", (steps.last?.elapsed ?? 0) * 1000))ms — \(path)")
+    }
+}
+
+// MARK: - Auth Flow Metrics
+/// Hop counts and durations of finished auth flows, keyed by flow name
+final class AuthFlowMetrics {
+    static let shared = AuthFlowMetrics()
+
+    struct Summary {
+        var runs = 0
+        var totalHops = 0
+        var totalMainHops = 0
+        var totalMilliseconds: Double = 0
+
+        var averageHops: Double {
+            runs == 0 ? 0 : Double(totalHops) / Double(runs)
+        }
+
+        var averageMilliseconds: Double {
+            runs == 0 ? 0 : totalMilliseconds / Double(runs)
+        }
+    }
+
+    private let lock = NSLock()
+    private var summaries: [String: Summary] = [:]
+
+    func record(_ trace: AuthFlowTrace) {
+        let hops = trace.hops
+        let mainHops = trace.mainHops
+        let milliseconds = (trace.steps.last?.elapsed ?? 0) * 1000
+
+        lock.lock()
+        defer { lock.unlock() }
+        var summary = summaries[trace.flow] ?? Summary()
+        summary.runs += 1
+        summary.totalHops += hops
+        summary.totalMainHops += mainHops
+        summary.totalMilliseconds += milliseconds
+        summaries[trace.flow] = summary
+    }
+
+    func summary(for flow: String) -> Summary? {
+        lock.lock()
+        defer { lock.unlock() }
+        return summaries[flow]
+    }
+
+    func report() -> String {
+        lock.lock()
+        defer { lock.unlock() }
+        var lines = ["🧵 Auth flow thread hops:"]
+        for (flow, summary) in summaries.sorted(by: { $0.key < $1.key }) {
+            lines.append("   \(flow) — \(summary.runs)x, avg \(String(format: "%.1f", summary.averageHops)) hops (\(summary.totalMainHops) to main total), avg \(String(format: "%.1f", summary.averageMilliseconds))ms")
+        }
+        return lines.joined(separator: "\n")
+    }
+}
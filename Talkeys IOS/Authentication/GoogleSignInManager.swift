@@ -14,24 +14,10 @@ class GoogleSignInManager: ObservableObject {
     @Published var errorMessage: String?
     
     private let authRepository: AuthRepository
-    private let googleSignInProvider: IOSGoogleSignInProvider
     
     private init() {
-        // Initialize shared KMP components
-        self.googleSignInProvider = IOSGoogleSignInProvider()
-        
-        // Initialize with your KMP shared components
-        let tokenStorage = IOSTokenStorage()
-        
-        // Don't initialize Koin here - it's done in LandingPage
-        // SharedModuleInitializerKt.doInitKoin() // Removed to prevent duplicate initialization
-        let apiClient = ApiClient()
-        
-        self.authRepository = AuthRepository(
-            httpClient: apiClient.httpClient,
-            googleSignInProvider: googleSignInProvider,
-            tokenStorage: tokenStorage
-        )
+        // Share the process-wide AuthRepository instead of building another HttpClient
+        self.authRepository = AppContainer.shared.authRepository
         
         checkSignInStatus()
     }
@@ -79,47 +65,53 @@ class GoogleSignInManager: ObservableObject {
         
         // Use Google Sign-In SDK
         print("🚀 Calling GIDSignIn.sharedInstance.signIn...")
+        let authRepository = self.authRepository
         GIDSignIn.sharedInstance.signIn(withPresenting: presentingViewController) { [weak self] result, error in
             print("📲 Google Sign-In callback received")
-            DispatchQueue.main.async {
-                self?.isLoading = false
-                
-                if let error = error {
-                    self?.errorMessage = "Google Sign-In failed: \(error.localizedDescription)"
-                    return
-                }
-                
-                guard let user = result?.user,
-                      let idToken = user.idToken?.tokenString else {
-                    self?.errorMessage = "Failed to get ID token from Google"
-                    return
-                }
-                
-                // Now use the shared KMP authentication
-                self?.authRepository.signInWithGoogle { authState, error in
-                    DispatchQueue.main.async {
-                        if let error = error {
-                            self?.errorMessage = "Backend authentication failed: \(error.localizedDescription)"
-                        } else if let authState = authState {
-                            switch authState {
-                            case is AuthState.Success:
-                                self?.isSignedIn = true
-                                print("✅ Successfully signed in with Google and authenticated with backend")
-                            case is AuthState.Error:
-                                if let errorState = authState as? AuthState.Error {
-                                    self?.errorMessage = errorState.message
-                                }
-                                self?.isSignedIn = false
-                            default:
-                                self?.isSignedIn = false
-                            }
-                        }
+            
+            if let error = error {
+                self?.finishSignIn(isSignedIn: false, error: "Google Sign-In failed: \(error.localizedDescription)")
+                return
+            }
+            
+            guard result?.user.idToken?.tokenString != nil else {
+                self?.finishSignIn(isSignedIn: false, error: "Failed to get ID token from Google")
+                return
+            }
+            
+            // Backend exchange through the shared KMP authentication, off main; state lands in one hop
+            Task.detached(priority: .userInitiated) {
+                do {
+                    let authState = try await HTTPMetrics.shared.measure(template: "auth/signInWithGoogle") {
+                        try await authRepository.signInWithGoogleCancellable()
+                    }
+                    switch authState {
+                    case is AuthState.Success:
+                        print("✅ Successfully signed in with Google and authenticated with backend")
+                        self?.finishSignIn(isSignedIn: true, error: nil)
+                    case let errorState as AuthState.Error:
+                        self?.finishSignIn(isSignedIn: false, error: errorState.message)
+                    default:
+                        self?.finishSignIn(isSignedIn: false, error: nil)
                     }
+                } catch {
+                    self?.finishSignIn(isSignedIn: false, error: "Backend authentication failed: \(error.localizedDescription)")
                 }
             }
         }
     }
     
+    /// The single main-thread state update at the end of `signIn()`
+    private func finishSignIn(isSignedIn: Bool, error: String?) {
+        DispatchQueue.main.async {
+            self.isLoading = false
+            self.isSignedIn = isSignedIn
+            if let error = error {
+                self.errorMessage = error
+            }
+        }
+    }
+    
     func signOut() {
         isLoading = true
         errorMessage = nil
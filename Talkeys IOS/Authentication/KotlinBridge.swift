@@ -0,0 +1,251 @@
+import Foundation
+import sharedKit
+
+// MARK: - Kotlin Bridge
+/// async/await and `AsyncStream` adapters for sharedKit's completion-handler and Flow exports.
+///
+/// The Objective-C export gives Swift no handle on the Kotlin `Job`, so cancellation is one-way:
+/// a cancelled Swift task resumes at once with `CancellationError` and any late Kotlin result is dropped.
+/// For the same reason a Flow collection parked on a quiet `StateFlow` can't be interrupted from Swift, so each
+/// Flow is collected once and shared by every stream on it; the collection ends at its first `emit` after the
+/// last stream goes away. SHAREDKIT_EXPORT_POLICY.md describes the Kotlin-side wrapper that would cancel it at once.
+enum KotlinBridge {
+    enum BridgeError: Error {
+        /// Kotlin completed with neither a value nor an error
+        case missingResult
+        /// Raised into Kotlin to stop a Flow collection whose Swift stream has ended
+        case collectionCancelled
+    }
+
+    /// Await a sharedKit `(Result?, Error?)` completion-handler call
+    static func result<T>(_ call: (@escaping (T?, Error?) -> Void) -> Void) async throws -> T {
+        let value: T? = try await optionalResult(call)
+        guard let value = value else { throw BridgeError.missingResult }
+        return value
+    }
+
+    /// Await a call whose Kotlin result is nullable (e.g. `TokenStorage.getToken`)
+    static func optionalResult<T>(_ call: (@escaping (T?, Error?) -> Void) -> Void) async throws -> T? {
+        // Don't start Kotlin work whose result nobody will read
+        try Task.checkCancellation()
+
+        let resumer = ResumeOnce<T?>()
+        return try await withTaskCancellationHandler {
+            try await withCheckedThrowingContinuation { continuation in
+                resumer.install(continuation)
+                call { value, error in
+                    resumer.resume(with: error.map { .failure($0) } ?? .success(value))
+                }
+            }
+        } onCancel: {
+            resumer.resume(with: .failure(CancellationError()))
+        }
+    }
+
+    /// Await a sharedKit `(Error?)` completion-handler call
+    static func completion(_ call: (@escaping (Error?) -> Void) -> Void) async throws {
+        let _: Bool? = try await optionalResult { completion in
+            call { error in completion(true, error) }
+        }
+    }
+
+    /// Collect a Kotlin `Flow` into an `AsyncStream`, keeping only the newest unread value.
+    /// A `StateFlow` stream starts with its current value. Streams on the same Flow share one Kotlin collection.
+    static func stream<T>(_ flow: Kotlinx_coroutines_coreFlow, of type: T.Type = T.self) -> AsyncStream<T> {
+        AsyncStream(bufferingPolicy: .bufferingNewest(1)) { continuation in
+            let key = SharedCollection<T>.Key(flow: ObjectIdentifier(flow), type: ObjectIdentifier(T.self))
+            while true {
+                let (collection, isNew) = sharedCollection(for: key, flow: flow)
+                if let subscription = collection.subscribe(continuation) {
+                    continuation.onTermination = { _ in collection.unsubscribe(subscription) }
+                    // Start only once subscribed, so a Flow that emits synchronously isn't cut off
+                    if isNew {
+                        collection.start()
+                    }
+                    return
+                }
+                // That collection stopped between lookup and subscribe; the next lookup starts a fresh one
+            }
+        }
+    }
+
+    // MARK: - Shared Collections
+
+    private static let collectionsLock = NSLock()
+    private static var collections: [AnyHashable: AnyObject] = [:]
+
+    private static func sharedCollection<T>(for key: SharedCollection<T>.Key, flow: Kotlinx_coroutines_coreFlow) -> (SharedCollection<T>, isNew: Bool) {
+        collectionsLock.lock()
+        if let existing = collections[key] as? SharedCollection<T>, !existing.isStopped {
+            collectionsLock.unlock()
+            return (existing, false)
+        }
+        let collection = SharedCollection<T>(flow: flow) { stopped in
+            collectionsLock.lock()
+            if collections[key] === stopped {
+                collections[key] = nil
+            }
+            collectionsLock.unlock()
+        }
+        collections[key] = collection
+        collectionsLock.unlock()
+        return (collection, true)
+    }
+
+    /// Number of Kotlin collections currently running; for tests
+    static var activeCollectionCount: Int {
+        collectionsLock.lock()
+        defer { collectionsLock.unlock() }
+        return collections.count
+    }
+}
+
+// MARK: - AuthRepository
+extension AuthRepository {
+    /// `checkExistingAuth` that returns promptly when the calling task is cancelled
+    func currentAuthState() async throws -> AuthState {
+        try await KotlinBridge.result { checkExistingAuth(completionHandler: $0) }
+    }
+
+    func signInWithGoogleCancellable() async throws -> AuthState {
+        try await KotlinBridge.result { signInWithGoogle(completionHandler: $0) }
+    }
+
+    func signOutCancellable() async throws {
+        try await KotlinBridge.completion { signOut(completionHandler: $0) }
+    }
+
+    /// Every `authState` change, starting with the current state
+    func authStates() -> AsyncStream<AuthState> {
+        KotlinBridge.stream(authState)
+    }
+}
+
+// MARK: - Private Helpers
+
+/// Resumes a continuation exactly once, whether Kotlin completion or Swift cancellation comes first
+private final class ResumeOnce<T> {
+    private let lock = NSLock()
+    private var continuation: CheckedContinuation<T, Error>?
+    private var pending: Result<T, Error>?
+    private var finished = false
+
+    func install(_ continuation: CheckedContinuation<T, Error>) {
+        lock.lock()
+        if let pending = pending {
+            lock.unlock()
+            continuation.resume(with: pending)
+            return
+        }
+        self.continuation = continuation
+        lock.unlock()
+    }
+
+    func resume(with result: Result<T, Error>) {
+        lock.lock()
+        guard !finished else {
+            lock.unlock()
+            return
+        }
+        finished = true
+        guard let continuation = continuation else {
+            // Cancelled before the continuation was installed
+            pending = result
+            lock.unlock()
+            return
+        }
+        self.continuation = nil
+        lock.unlock()
+        continuation.resume(with: result)
+    }
+}
+
+/// One Kotlin `collect` on a Flow, fanned out to every Swift stream subscribed to it
+private final class SharedCollection<T>: NSObject, Kotlinx_coroutines_coreFlowCollector {
+    struct Key: Hashable {
+        let flow: ObjectIdentifier
+        let type: ObjectIdentifier
+    }
+
+    private let flow: Kotlinx_coroutines_coreFlow
+    private let onStop: (SharedCollection<T>) -> Void
+    private let lock = NSLock()
+    private var subscribers: [UUID: AsyncStream<T>.Continuation] = [:]
+    /// Last value seen, replayed to late subscribers when the Flow is a `StateFlow`
+    private var latest: T?
+    private var stopped = false
+
+    init(flow: Kotlinx_coroutines_coreFlow, onStop: @escaping (SharedCollection<T>) -> Void) {
+        self.flow = flow
+        self.onStop = onStop
+    }
+
+    var isStopped: Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        return stopped
+    }
+
+    func start() {
+        flow.collect(collector: self) { [weak self] _ in
+            self?.stop(finishing: true)
+        }
+    }
+
+    /// nil when the collection has already stopped
+    func subscribe(_ continuation: AsyncStream<T>.Continuation) -> UUID? {
+        lock.lock()
+        guard !stopped else {
+            lock.unlock()
+            return nil
+        }
+        let id = UUID()
+        subscribers[id] = continuation
+        // Later subscribers missed the StateFlow's first emission, so start them on its current value
+        if flow is Kotlinx_coroutines_coreStateFlow, let latest = latest {
+            continuation.yield(latest)
+        }
+        lock.unlock()
+        return id
+    }
+
+    func unsubscribe(_ id: UUID) {
+        lock.lock()
+        subscribers[id] = nil
+        lock.unlock()
+    }
+
+    func emit(value: Any?, completionHandler: @escaping (Error?) -> Void) {
+        lock.lock()
+        guard !stopped, !subscribers.isEmpty else {
+            lock.unlock()
+            stop(finishing: false)
+            completionHandler(KotlinBridge.BridgeError.collectionCancelled)
+            return
+        }
+        // Yielded under the lock so a subscriber joining now sees either this value or the replay, in order
+        if let value = value as? T {
+            latest = value
+            subscribers.values.forEach { $0.yield(value) }
+        }
+        lock.unlock()
+        completionHandler(nil)
+    }
+
+    /// `finishing` ends the subscribed streams too, for when the Flow itself completed or failed
+    private func stop(finishing: Bool) {
+        lock.lock()
+        let wasStopped = stopped
+        stopped = true
+        let remaining = finishing ? Array(subscribers.values) : []
+        if finishing {
+            subscribers.removeAll()
+        }
+        lock.unlock()
+
+        remaining.forEach { $0.finish() }
+        if !wasStopped {
+            onStop(self)
+        }
+    }
+}
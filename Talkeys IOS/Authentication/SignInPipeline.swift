@@ -0,0 +1,140 @@
+import Foundation
+import sharedKit
+
+// MARK: - Sign-In Pipeline
+/// Post-Google-Sign-In work, run concurrently off the main thread:
+/// the token handoff (keychain vault plus sharedKit's `TokenStorage`), persisting the user to
+/// `TalkeysDatabase`, and prefetching the profile picture into the URL cache `AsyncImage` reads.
+/// The caller publishes a single state transition once `run` returns; the prefetch is not waited on.
+final class SignInPipeline {
+    enum Stage: String, CaseIterable {
+        case tokenExchange
+        case persistUser
+        case prefetchImage
+    }
+
+    struct Report {
+        let user: AppUser
+        /// Wall-clock seconds per awaited stage; they overlap, so these do not add up to `total`
+        let durations: [Stage: TimeInterval]
+        let total: TimeInterval
+        /// Non-fatal stage failures (persistence never fails the sign-in)
+        let failures: [Stage: Error]
+        /// The avatar prefetch, still running when `run` returns. Resolves to its error, if any.
+        let imagePrefetch: Task<Error?, Never>
+
+        var summary: String {
+            let stages = Stage.allCases.compactMap { stage in
+                durations[stage].map { "\(stage.rawValue) \(String(format: "%.1f", $0 * 1000))ms" + (failures[stage] == nil ? "" : " (failed)") }
+            }
+            return "⏱️ Sign-in pipeline \(String(format: "%.1f", total * 1000))ms — " + stages.joined(separator: ", ")
+        }
+    }
+
+    /// Each stage is injectable so tests can run the pipeline without the keychain, sharedKit or network
+    struct Stages {
+        var exchangeToken: (String) async throws -> Void
+        var persistUser: (AppUser) async throws -> Void
+        var prefetchImage: (URL) async throws -> Void
+    }
+
+    private let stages: Stages
+
+    init(stages: Stages) {
+        self.stages = stages
+    }
+
+    /// Live stages backed by the container's singletons
+    convenience init(container: AppContainer = .shared, client: URLSession = .shared) {
+        let profileStore = container.userProfileStore
+        self.init(stages: Stages(
+            exchangeToken: { idToken in
+                try await AuthDispatch.io { try TokenManager.shared.saveToken(idToken).get() }
+                // Hand the same token to the shared module so its AuthRepository sees this session.
+                // The vault copy is the one API calls use, so a failure here is only logged.
+                let tokenStorage = container.tokenStorage
+                do {
+                    try await KotlinBridge.completion { tokenStorage.saveToken(token: idToken, completionHandler: $0) }
+                } catch {
+                    print("⚠️ Failed to hand token to shared module: \(error.localizedDescription)")
+                }
+            },
+            persistUser: { user in
+                await AuthDispatch.io { profileStore.save(user) }
+            },
+            prefetchImage: { url in
+                // AsyncImage loads through URLSession.shared, so warming its cache makes the avatar instant
+                var request = URLRequest(url: url, cachePolicy: .returnCacheDataElseLoad)
+                request.timeoutInterval = HTTPClientProfile.default.timeout(for: .media)
+                _ = try await HTTPMetrics.shared.measure(template: "profileImage") {
+                    try await client.data(for: request)
+                }
+            }
+        ))
+    }
+
+    /// Run the token exchange and persistence concurrently and return once both finish.
+    /// The avatar prefetch (up to the media timeout) carries on detached. Throws only when the token exchange fails.
+    func run(idToken: String, user: AppUser, trace: AuthFlowTrace? = nil) async throws -> Report {
+        let start = CFAbsoluteTimeGetCurrent()
+        let stages = self.stages
+
+        let imagePrefetch = Task.detached(priority: .utility) { () -> Error? in
+            let result = await Self.time(.prefetchImage, trace: trace) {
+                guard let url = user.profilePicture.flatMap(URL.init(string:)) else { return }
+                try await stages.prefetchImage(url)
+            }
+            if let error = result.error {
+                print("⚠️ Sign-in stage \(result.stage.rawValue) failed: \(error.localizedDescription)")
+            }
+            return result.error
+        }
+
+        async let token = Self.time(.tokenExchange, trace: trace) {
+            try await stages.exchangeToken(idToken)
+        }
+        async let persisted = Self.time(.persistUser, trace: trace) {
+            try await stages.persistUser(user)
+        }
+
+        let results = await [token, persisted]
+        if let tokenError = results[0].error {
+            imagePrefetch.cancel()
+            throw tokenError
+        }
+
+        var durations: [Stage: TimeInterval] = [:]
+        var failures: [Stage: Error] = [:]
+        for result in results {
+            durations[result.stage] = result.duration
+            if let error = result.error {
+                print("⚠️ Sign-in stage \(result.stage.rawValue) failed: \(error.localizedDescription)")
+                failures[result.stage] = error
+            }
+        }
+
+        let report = Report(user: user, durations: durations, total: CFAbsoluteTimeGetCurrent() - start, failures: failures, imagePrefetch: imagePrefetch)
+        print(report.summary)
+        return report
+    }
+
+    // MARK: - Private Helpers
+
+    private struct StageResult {
+        let stage: Stage
+        let duration: TimeInterval
+        let error: Error?
+    }
+
+    private static func time(_ stage: Stage, trace: AuthFlowTrace?, _ body: () async throws -> Void) async -> StageResult {
+        let start = CFAbsoluteTimeGetCurrent()
+        var failure: Error?
+        do {
+            try await body()
+        } catch {
+            failure = error
+        }
+        trace?.mark(stage.rawValue)
+        return StageResult(stage: stage, duration: CFAbsoluteTimeGetCurrent() - start, error: failure)
+    }
+}
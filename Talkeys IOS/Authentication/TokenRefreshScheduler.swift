@@ -0,0 +1,150 @@
+import Foundation
+import Combine
+import GoogleSignIn
+
+// MARK: - Token Refresh Scheduler
+/// Renews the auth token in the background before it expires.
+/// Concurrent refresh attempts share one in-flight task, and requests that hit
+/// `APIError.unauthorized` wait for that refresh and are retried once with the new token.
+final class TokenRefreshScheduler {
+    static let shared = TokenRefreshScheduler()
+
+    typealias Refresher = () async throws -> String
+
+    /// How long before expiry a refresh is attempted
+    static let refreshLeadTime: TimeInterval = 2 * 60
+    /// Lower bound between scheduled attempts so a provider that hands back the same token can't spin
+    static let minimumRefreshDelay: TimeInterval = 30
+
+    private let vault: TokenVault
+    private let refresher: Refresher
+    private let coordinator = RefreshCoordinator()
+    private let lock = NSLock()
+
+    private var scheduledRefresh: Task<Void, Never>?
+    private var tokenSubscription: AnyCancellable?
+
+    init(vault: TokenVault = .shared, refresher: @escaping Refresher = TokenRefreshScheduler.refreshGoogleIDToken) {
+        self.vault = vault
+        self.refresher = refresher
+    }
+
+    // MARK: - Scheduling
+
+    /// Start watching the vault and keep a refresh scheduled ahead of the current expiry
+    func start() {
+        lock.lock()
+        let alreadyStarted = tokenSubscription != nil
+        if !alreadyStarted {
+            tokenSubscription = vault.tokenDidChange.sink { [weak self] _ in
+                self?.scheduleNextRefresh()
+            }
+        }
+        lock.unlock()
+
+        if !alreadyStarted {
+            scheduleNextRefresh()
+        }
+    }
+
+    func stop() {
+        lock.lock()
+        tokenSubscription = nil
+        scheduledRefresh?.cancel()
+        scheduledRefresh = nil
+        lock.unlock()
+    }
+
+    private func scheduleNextRefresh() {
+        lock.lock()
+        defer { lock.unlock() }
+
+        scheduledRefresh?.cancel()
+        scheduledRefresh = nil
+
+        guard vault.currentToken != nil, let expiry = vault.expiryDate else { return }
+
+        let delay = max(expiry.timeIntervalSinceNow - TokenRefreshScheduler.refreshLeadTime, TokenRefreshScheduler.minimumRefreshDelay)
+        print("⏰ Token refresh scheduled in \(Int(delay))s")
+
+        scheduledRefresh = Task(priority: .utility) { [weak self] in
+            try? await Task.sleep(nanoseconds: UInt64(delay * 1_000_000_000))
+            guard !Task.isCancelled else { return }
+            _ = try? await self?.refreshNow()
+        }
+    }
+
+    // MARK: - Refresh
+
+    /// Refresh the token now. Callers that arrive while a refresh is running share its result.
+    @discardableResult
+    func refreshNow() async throws -> String {
+        let token = try await coordinator.run(refresher)
+        if token != vault.currentToken {
+            _ = vault.save(token)
+        }
+        return token
+    }
+
+    /// Run an authorized request; on 401 wait for a (shared) token refresh and retry once
+    func performAuthorized<T>(_ operation: (String?) async throws -> T) async throws -> T {
+        do {
+            return try await operation(vault.currentToken)
+        } catch APIError.unauthorized {
+            print("🔄 Request unauthorized, waiting for token refresh...")
+            let refreshedToken = try await refreshNow()
+            return try await operation(refreshedToken)
+        }
+    }
+
+    // MARK: - Google Refresher
+
+    /// Silently renews the Google ID token that the app uses as its bearer token
+    static func refreshGoogleIDToken() async throws -> String {
+        try await withCheckedThrowingContinuation { continuation in
+            DispatchQueue.main.async {
+                // The refresh can run before the deferred startup stage has configured GIDSignIn
+                if GIDSignIn.sharedInstance.configuration == nil {
+                    Talkeys_IOSApp.configureGoogleSignIn()
+                }
+                
+                let finish: (GIDGoogleUser?, Error?) -> Void = { user, error in
+                    if let token = user?.idToken?.tokenString {
+                        continuation.resume(returning: token)
+                    } else {
+                        continuation.resume(throwing: error ?? APIError.unauthorized)
+                    }
+                }
+
+                if let currentUser = GIDSignIn.sharedInstance.currentUser {
+                    currentUser.refreshTokensIfNeeded(completion: finish)
+                } else {
+                    GIDSignIn.sharedInstance.restorePreviousSignIn { user, error in
+                        guard let user = user else {
+                            finish(nil, error)
+                            return
+                        }
+                        user.refreshTokensIfNeeded(completion: finish)
+                    }
+                }
+            }
+        }
+    }
+}
+
+// MARK: - Refresh Coordinator
+/// Coalesces concurrent refreshes into a single in-flight task
+private actor RefreshCoordinator {
+    private var inFlight: Task<String, Error>?
+
+    func run(_ refresher: @escaping TokenRefreshScheduler.Refresher) async throws -> String {
+        if let inFlight = inFlight {
+            return try await inFlight.value
+        }
+
+        let task = Task { try await refresher() }
+        inFlight = task
+        defer { inFlight = nil }
+        return try await task.value
+    }
+}
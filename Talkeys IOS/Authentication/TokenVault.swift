@@ -0,0 +1,200 @@
+import Foundation
+import Combine
+import Security
+
+// MARK: - Token Vault
+/// Single source of truth for the auth token.
+/// The token is persisted in the Keychain and cached in memory, so the hot request path
+/// (`EventAPIService`, `NetworkUtils`, `RequestBuilder`) does a memory read instead of a defaults lookup.
+final class TokenVault {
+    static let shared = TokenVault()
+
+    /// Emits the new token (or nil when cleared) every time it changes
+    let tokenDidChange = PassthroughSubject<String?, Never>()
+
+    /// Used when the token is not a JWT or carries no `exp` claim
+    static let fallbackLifetime: TimeInterval = 24 * 60 * 60
+
+    private let service: String
+    private let account = "auth_token"
+    private let legacyTokenKey = "auth_token"
+    private let legacyExpiryKey = "auth_token_expiry"
+    private let defaults: UserDefaults
+    private let lock = NSLock()
+
+    private var cachedToken: String?
+    private var cachedExpiry: Date?
+    private var hasLoaded = false
+
+    /// - Parameter defaults: Where older builds kept the token; read once for the migration
+    init(service: String = (Bundle.main.bundleIdentifier ?? "Talkeys") + ".auth", defaults: UserDefaults = .standard) {
+        self.service = service
+        self.defaults = defaults
+    }
+
+    // MARK: - Reads (memory only after first access)
+
+    var currentToken: String? {
+        loadIfNeeded()
+        lock.lock()
+        defer { lock.unlock() }
+        return cachedToken
+    }
+
+    var expiryDate: Date? {
+        loadIfNeeded()
+        lock.lock()
+        defer { lock.unlock() }
+        return cachedExpiry
+    }
+
+    /// Token that is present and not yet expired
+    var validToken: String? {
+        loadIfNeeded()
+        lock.lock()
+        defer { lock.unlock() }
+        guard let token = cachedToken, !token.isEmpty else { return nil }
+        if let expiry = cachedExpiry, expiry <= Date() { return nil }
+        return token
+    }
+
+    // MARK: - Writes
+
+    func save(_ token: String) -> Result<Void, TokenError> {
+        let result = writeToKeychain(token)
+        if case .success = result {
+            update(token: token)
+        }
+        return result
+    }
+
+        var status = SecItemUpdate(baseQuery() as CFDictionary, [kSecValueData as String: data] as CFDictionary)
+        if status == errSecItemNotFound {
+            var attributes = baseQuery()
+            attributes[kSecValueData as String] = data
+            // Readable after first unlock so background refresh can attach the token
+            attributes[kSecAttrAccessible as String] = kSecAttrAccessibleAfterFirstUnlock
+            status = SecItemAdd(attributes as CFDictionary, nil)
+        }
+
+    func clear() -> Result<Void, TokenError> {
+        let status = SecItemDelete(baseQuery() as CFDictionary)
+        guard status == errSecSuccess || status == errSecItemNotFound else {
+            print("❌ Keychain delete failed with status \(status)")
+            return .failure(.clearFailed)
+        }
+
+        update(token: nil)
+        return .success(())
+    }
+
+    // MARK: - JWT
+
+    /// Reads the `exp` claim from a JWT payload. Returns nil for opaque tokens.
+    static func expiry(ofJWT token: String) -> Date? {
+        let segments = token.split(separator: ".")
+        guard segments.count == 3 else { return nil }
+
+        var payload = String(segments[1])
+            .replacingOccurrences(of: "-", with: "+")
+            .replacingOccurrences(of: "_", with: "/")
+        payload += String(repeating: "=", count: (4 - payload.count % 4) % 4)
+
+        guard let data = Data(base64Encoded: payload),
+              let claims = try? JSONSerialization.jsonObject(with: data) as? [String: Any],
+              let exp = claims["exp"] as? TimeInterval else {
+            return nil
+        }
+        return Date(timeIntervalSince1970: exp)
+    }
+
+    // MARK: - Private Helpers
+
+    private func baseQuery() -> [String: Any] {
+        [
+            kSecClass as String: kSecClassGenericPassword,
+            kSecAttrService as String: service,
+            kSecAttrAccount as String: account
+        ]
+    }
+
+    /// Persists without touching the cache or notifying subscribers
+    private func writeToKeychain(_ token: String) -> Result<Void, TokenError> {
+        guard let data = token.data(using: .utf8) else { return .failure(.saveFailed) }
+
+        var status = SecItemUpdate(baseQuery() as CFDictionary, [kSecValueData as String: data] as CFDictionary)
+        if status == errSecItemNotFound {
+            var attributes = baseQuery()
+            attributes[kSecValueData as String] = data
+            // Readable after first unlock so background refresh can attach the token
+            attributes[kSecAttrAccessible as String] = kSecAttrAccessibleAfterFirstUnlock
+            status = SecItemAdd(attributes as CFDictionary, nil)
+        }
+
+        guard status == errSecSuccess else {
+            print("❌ Keychain save failed with status \(status)")
+            return .failure(.saveFailed)
+        }
+        return .success(())
+    }
+
+    private func update(token: String?) {
+        lock.lock()
+        cachedToken = token
+        cachedExpiry = token.map { TokenVault.expiry(ofJWT: $0) ?? Date().addingTimeInterval(TokenVault.fallbackLifetime) }
+        hasLoaded = true
+        lock.unlock()
+
+        tokenDidChange.send(token)
+    }
+
+    private func loadIfNeeded() {
+        lock.lock()
+        let loaded = hasLoaded
+        lock.unlock()
+        guard !loaded else { return }
+
+        // Read before the migration removes it
+        let storedExpiry = legacyExpiry()
+        let token = readFromKeychain() ?? migrateLegacyToken()
+
+        lock.lock()
+        if !hasLoaded {
+            cachedToken = token
+            cachedExpiry = token.map { TokenVault.expiry(ofJWT: $0) ?? storedExpiry ?? Date().addingTimeInterval(TokenVault.fallbackLifetime) }
+            hasLoaded = true
+        }
+        lock.unlock()
+    }
+
+    private func readFromKeychain() -> String? {
+        var query = baseQuery()
+        query[kSecReturnData as String] = true
+        query[kSecMatchLimit as String] = kSecMatchLimitOne
+
+        var result: AnyObject?
+        guard SecItemCopyMatching(query as CFDictionary, &result) == errSecSuccess,
+              let data = result as? Data else {
+            return nil
+        }
+        return String(data: data, encoding: .utf8)
+    }
+
+    /// One-time move of the token that older builds kept in UserDefaults.
+    /// Runs inside the first read, so it writes without publishing: the token isn't a change to subscribers.
+    private func migrateLegacyToken() -> String? {
+        guard let token = defaults.string(forKey: legacyTokenKey), !token.isEmpty else { return nil }
+
+        if case .success = writeToKeychain(token) {
+            defaults.removeObject(forKey: legacyTokenKey)
+            defaults.removeObject(forKey: legacyExpiryKey)
+            print("🔐 Migrated auth token from UserDefaults to Keychain")
+        }
+        return token
+    }
+
+    private func legacyExpiry() -> Date? {
+        let expiryTime = defaults.double(forKey: legacyExpiryKey)
+        return expiryTime > 0 ? Date(timeIntervalSince1970: expiryTime) : nil
+    }
+}
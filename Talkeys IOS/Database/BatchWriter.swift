@@ -0,0 +1,96 @@
+import Foundation
+import sharedKit
+
+// MARK: - Driver Helpers
+/// Written against `RuntimeSqlDriver` so they work on `SQLiteDriver` and on wrappers like `InstrumentedSqlDriver`
+extension RuntimeSqlDriver {
+    /// Run `body` inside a (possibly nested) transaction; rolls back if it throws
+    func transaction<T>(_ body: () throws -> T) rethrows -> T {
+        guard let current = doNewTransaction().value as? RuntimeTransacterTransaction else {
+            return try body()
+        }
+        do {
+            let result = try body()
+            _ = current.endTransaction(successful: true)
+            return result
+        } catch {
+            _ = current.endTransaction(successful: false)
+            throw error
+        }
+    }
+
+    /// Like `transaction`, but throws the `SQLiteError` that made the driver roll it back.
+    /// Use where the caller must not carry on as if the writes landed.
+    func checkedTransaction<T>(_ body: () throws -> T) throws -> T {
+        guard let current = doNewTransaction().value as? RuntimeTransacterTransaction else {
+            return try body()
+        }
+        let result: T
+        do {
+            result = try body()
+        } catch {
+            _ = current.endTransaction(successful: false)
+            throw error
+        }
+        _ = current.endTransaction(successful: true)
+        if let failure = (current as? SQLiteDriver.Transaction)?.failure {
+            throw failure
+        }
+        return result
+    }
+
+    /// Notify listeners registered on the given table keys
+    func notifyListeners(tables: [String]) {
+        let queryKeys = KotlinArray<NSString>(size: Int32(tables.count)) { tables[$0.intValue] as NSString }
+        notifyListeners(queryKeys: queryKeys)
+    }
+
+    func tableExists(_ name: String) -> Bool {
+        let result = executeQuery(identifier: nil, sql: "SELECT 1 FROM sqlite_master WHERE name = ?", mapper: { cursor in
+            SQLiteQueryResult(KotlinBoolean(bool: (cursor.next().value as? KotlinBoolean)?.boolValue ?? false))
+        }, parameters: 1) { $0.bindString(index: 0, string: name) }
+        return (result.value as? KotlinBoolean)?.boolValue ?? false
+    }
+
+    /// Run one statement per row inside a single transaction.
+    /// The identifier keeps the statement prepared for every row, so each row only binds and steps.
+    /// - Returns: total rows changed
+    @discardableResult
+    func executeBatch<Row>(identifier: Int32, sql: String, parameters: Int32, rows: [Row], bind: @escaping (Row, RuntimeSqlPreparedStatement) -> Void) -> Int {
+        guard !rows.isEmpty else { return 0 }
+
+        let cacheKey = KotlinInt(int: identifier)
+        return transaction {
+            rows.reduce(0) { changed, row in
+                let result = execute(identifier: cacheKey, sql: sql, parameters: parameters) { bind(row, $0) }
+                return changed + ((result.value as? KotlinLong)?.intValue ?? 0)
+            }
+        }
+    }
+}
+
+// MARK: - UserQueries Bulk Upsert
+extension UserQueries {
+    /// ISO8601DateFormatter is thread-safe and costly to create, so one serves every upsert
+    private static let createdAtFormatter = ISO8601DateFormatter()
+
+    /// Insert new users and update existing ones in one SQLDelight transaction.
+    /// Uses the generated statements (already identifier-cached by the driver); each user is
+    /// looked up by primary key, so the cost follows the batch size rather than the table size.
+    /// Users without `createdAt` (fresh from sign-in) are stamped with the current time.
+    func upsert(_ users: [AppUser]) {
+        guard !users.isEmpty else { return }
+        let now = UserQueries.createdAtFormatter.string(from: Date())
+
+        transaction(noEnclosing: false) { _ in
+            for user in users {
+                let exists = self.selectById(id: user.id) { id, _, _, _, _ in id as NSString }.executeAsOneOrNull() != nil
+                if exists {
+                    self.updateUser(name: user.name, email: user.email, profilePicture: user.profilePicture, id: user.id)
+                } else {
+                    self.insertUser(id: user.id, name: user.name, email: user.email, profilePicture: user.profilePicture, createdAt: user.createdAt ?? now)
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,70 @@
+import Foundation
+import sharedKit
+
+// MARK: - Database Provider
+/// Opens the on-device `TalkeysDatabase` and brings its schema up to date.
+/// Resolve through `AppContainer.shared.databaseProvider` so the app holds one connection.
+final class DatabaseProvider {
+    static let fileName = "talkeys.db"
+
+    let driver: SQLiteDriver
+    /// Statement metrics for everything the queries run (nil when not instrumented)
+    let instrumentation: InstrumentedSqlDriver?
+    let database: TalkeysDatabase
+    /// Event tables live in the same file, next to the generated user table
+    let eventQueries: EventQueries
+    /// Heavy data migrations, run after launch by the "DatabaseMigrations" startup stage
+    let migrations: MigrationRunner
+
+    /// - Parameters:
+    ///   - path: defaults to Application Support/talkeys.db; pass ":memory:" in tests
+    ///   - configuration: WAL, pragmas and reader pool size for the driver
+    ///   - instrumented: route queries through `InstrumentedSqlDriver` (on by default in debug builds)
+    init(path: String = DatabaseProvider.defaultPath(), configuration: SQLiteConfiguration = .default, instrumented: Bool = DatabaseProvider.instrumentByDefault) {
+        driver = SQLiteDriver(path: path, configuration: configuration)
+        DatabaseProvider.prepareSchema(on: driver)
+
+        instrumentation = instrumented ? InstrumentedSqlDriver(wrapping: driver) : nil
+        let queryDriver: RuntimeSqlDriver = instrumentation ?? driver
+        database = TalkeysDatabaseCompanion.shared.invoke(driver: queryDriver)
+        eventQueries = EventQueries(driver: queryDriver)
+        migrations = MigrationRunner(driver: queryDriver, migrations: [EventQueries.SearchIndexBackfill()])
+    }
+
+    static var instrumentByDefault: Bool {
+        #if DEBUG
+        return true
+        #else
+        return false
+        #endif
+    }
+
+    var userQueries: UserQueries {
+        database.userQueries
+    }
+
+    // MARK: - Schema
+
+    private static func prepareSchema(on driver: SQLiteDriver) {
+        let schema = TalkeysDatabaseCompanion.shared.Schema
+        let currentVersion = driver.userVersion
+
+        if currentVersion == 0 {
+            _ = schema.create(driver: driver)
+            print("🗄️ Created TalkeysDatabase schema v\(schema.version)")
+        } else if currentVersion < schema.version {
+            let callbacks = KotlinArray<RuntimeAfterVersion>(size: 0) { _ in nil }
+            _ = schema.migrate(driver: driver, oldVersion: currentVersion, newVersion: schema.version, callbacks: callbacks)
+            print("🗄️ Migrated TalkeysDatabase v\(currentVersion) → v\(schema.version)")
+        }
+        driver.userVersion = schema.version
+        MigrationRunner.createSchema(on: driver)
+        EventQueries.createSchema(on: driver)
+    }
+
+    static func defaultPath() -> String {
+        let directory = FileManager.default.urls(for: .applicationSupportDirectory, in: .userDomainMask)[0]
+        try? FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+        return directory.appendingPathComponent(fileName).path
+    }
+}
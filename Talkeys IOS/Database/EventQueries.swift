@@ -0,0 +1,302 @@
+import Foundation
+import sharedKit
+
+// MARK: - Event Queries
+/// Local event store in the same `TalkeysDatabase` file, written in the shape SQLDelight generates
+/// (fixed statement identifiers, listener notification on the `event` table key).
+/// The filters `EventRepository` used to do by hand are indexed SQL queries here.
+final class EventQueries {
+    static let tableKey = "event"
+
+    /// Statement identifiers for the driver's prepared-statement cache
+    private enum Identifier: Int32 {
+        case upsert = 310_001
+        case selectAll
+        case selectById
+        case selectLive
+        case selectPast
+        case selectByCategory
+        case deleteAll
+        case count
+        case search
+    }
+
+    static let schema = [
+        """
+        CREATE TABLE IF NOT EXISTS event (
+            id TEXT NOT NULL PRIMARY KEY,
+            name TEXT NOT NULL,
+            category TEXT NOT NULL,
+            isLive INTEGER NOT NULL,
+            startDate TEXT NOT NULL,
+            location TEXT,
+            eventDescription TEXT,
+            organizerName TEXT,
+            position INTEGER NOT NULL,
+            payload TEXT NOT NULL,
+            updatedAt REAL NOT NULL
+        )
+        """,
+        "CREATE INDEX IF NOT EXISTS event_isLive_startDate ON event(isLive, startDate)",
+        "CREATE INDEX IF NOT EXISTS event_category ON event(category COLLATE NOCASE, startDate)",
+        "CREATE INDEX IF NOT EXISTS event_startDate ON event(startDate)"
+    ]
+
+    /// FTS5 index over the searchable columns, kept in sync by triggers. It stores its own copy of the
+    /// text so a delete by rowid is safe even for rows the background backfill hasn't reached yet.
+    /// Upserts use ON CONFLICT DO UPDATE so the rowid is stable and the update trigger fires.
+    static let searchSchema = [
+        """
+        CREATE VIRTUAL TABLE IF NOT EXISTS event_search USING fts5(
+            name, location, category, eventDescription, organizerName,
+            tokenize='unicode61 remove_diacritics 2', prefix='2 3'
+        )
+        """,
+        """
+        CREATE TRIGGER IF NOT EXISTS event_search_insert AFTER INSERT ON event BEGIN
+            INSERT INTO event_search(rowid, name, location, category, eventDescription, organizerName)
+            VALUES (new.rowid, new.name, new.location, new.category, new.eventDescription, new.organizerName);
+        END
+        """,
+        """
+        CREATE TRIGGER IF NOT EXISTS event_search_delete AFTER DELETE ON event BEGIN
+            DELETE FROM event_search WHERE rowid = old.rowid;
+        END
+        """,
+        """
+        CREATE TRIGGER IF NOT EXISTS event_search_update AFTER UPDATE ON event BEGIN
+            DELETE FROM event_search WHERE rowid = old.rowid;
+            INSERT INTO event_search(rowid, name, location, category, eventDescription, organizerName)
+            VALUES (new.rowid, new.name, new.location, new.category, new.eventDescription, new.organizerName);
+        END
+        """
+    ]
+
+    private let driver: RuntimeSqlDriver
+    private let encoder = JSONEncoder()
+    private let decoder = JSONDecoder()
+
+    init(driver: RuntimeSqlDriver) {
+        self.driver = driver
+    }
+
+    /// Schema only; rows written before the search index existed are indexed by `SearchIndexBackfill` after launch
+    static func createSchema(on driver: SQLiteDriver) {
+        schema.forEach { driver.exec($0) }
+        searchSchema.forEach { driver.exec($0) }
+    }
+
+    // MARK: - Writes
+
+    /// Upsert events, keeping the API order in `position`
+    func upsert(_ events: [EventResponse], startingAt position: Int = 0) {
+        guard !events.isEmpty else { return }
+
+        upsertRows(events.enumerated().map { (event: $0.element, position: position + $0.offset) })
+        notifyEventTable()
+    }
+
+    /// Replace the whole store with a fresh first page from the API
+    func replaceAll(with events: [EventResponse]) {
+        driver.transaction {
+            deleteAll(notify: false)
+            upsertRows(events.enumerated().map { (event: $0.element, position: $0.offset) })
+        }
+        notifyEventTable()
+    }
+
+    func deleteAll() {
+        deleteAll(notify: true)
+    }
+
+    // MARK: - Reads
+
+    func selectAll() -> [EventResponse] {
+        selectEvents(.selectAll, sql: "SELECT payload FROM event ORDER BY position")
+    }
+
+    func selectById(_ id: String) -> EventResponse? {
+        selectEvents(.selectById, sql: "SELECT payload FROM event WHERE id = ?", parameters: 1) {
+            $0.bindString(index: 0, string: id)
+        }.first
+    }
+
+    func selectLive() -> [EventResponse] {
+        selectEvents(.selectLive, sql: "SELECT payload FROM event WHERE isLive = 1 ORDER BY startDate")
+    }
+
+    func selectPast() -> [EventResponse] {
+        selectEvents(.selectPast, sql: "SELECT payload FROM event WHERE isLive = 0 ORDER BY startDate DESC")
+    }
+
+    func selectByCategory(_ category: String) -> [EventResponse] {
+        selectEvents(.selectByCategory, sql: "SELECT payload FROM event WHERE category = ? COLLATE NOCASE ORDER BY startDate", parameters: 1) {
+            $0.bindString(index: 0, string: category)
+        }
+    }
+
+    /// Ranked full-text search; every word in `text` must prefix-match one of the indexed columns.
+    /// Name matches weigh most, then location/category, organizer, description.
+    func search(_ text: String, limit: Int = 50, offset: Int = 0) -> [EventResponse] {
+        guard let match = EventQueries.matchExpression(for: text) else { return [] }
+
+        return selectEvents(.search, sql: """
+            SELECT event.payload FROM event_search
+            JOIN event ON event.rowid = event_search.rowid
+            WHERE event_search MATCH ?
+            ORDER BY bm25(event_search, 10.0, 4.0, 4.0, 1.0, 2.0)
+            LIMIT ? OFFSET ?
+            """, parameters: 3) {
+            $0.bindString(index: 0, string: match)
+            $0.bindLong(index: 1, long: KotlinLong(longLong: Int64(limit)))
+            $0.bindLong(index: 2, long: KotlinLong(longLong: Int64(offset)))
+        }
+    }
+
+    /// Turn free text into an FTS5 query of quoted prefix terms, so user input can't inject syntax
+    static func matchExpression(for text: String) -> String? {
+        let terms = text
+            .components(separatedBy: CharacterSet.alphanumerics.inverted)
+            .filter { !$0.isEmpty }
+            .map { "\"\($0)\"*" }
+        return terms.isEmpty ? nil : terms.joined(separator: " ")
+    }
+
+    func count() -> Int {
+        let result = driver.executeQuery(
+            identifier: KotlinInt(int: Identifier.count.rawValue),
+            sql: "SELECT COUNT(*) FROM event",
+            mapper: { cursor in
+                let hasRow = (cursor.next().value as? KotlinBoolean)?.boolValue ?? false
+                return SQLiteQueryResult(hasRow ? cursor.getLong(index: 0) : nil)
+            },
+            parameters: 0,
+            binders: nil
+        )
+        return (result.value as? KotlinLong)?.intValue ?? 0
+    }
+
+    // MARK: - Observation
+
+    /// Re-run `fetch` whenever the event table changes, e.g. `queries.changes { $0.selectLive() }`.
+    /// Doesn't keep these queries alive; the stream finishes once they are released.
+    func changes<Value>(_ fetch: @escaping (EventQueries) -> Value) -> AsyncStream<Value> {
+        QueryChanges.stream(driver: driver, tables: [EventQueries.tableKey], owner: self, fetch: fetch)
+    }
+
+    // MARK: - Private Helpers
+
+    /// Encode payloads up front, then write every row through the one cached upsert statement
+    private func upsertRows(_ rows: [(event: EventResponse, position: Int)]) {
+        let now = KotlinDouble(double: Date().timeIntervalSince1970)
+        let encoded: [(event: EventResponse, position: Int, payload: String)] = rows.compactMap { row in
+            guard let data = try? encoder.encode(row.event), let payload = String(data: data, encoding: .utf8) else { return nil }
+            return (row.event, row.position, payload)
+        }
+
+        driver.executeBatch(
+            identifier: Identifier.upsert.rawValue,
+            sql: """
+            INSERT INTO event(id, name, category, isLive, startDate, location, eventDescription, organizerName, position, payload, updatedAt)
+            VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)
+            ON CONFLICT(id) DO UPDATE SET
+                name = excluded.name, category = excluded.category, isLive = excluded.isLive,
+                startDate = excluded.startDate, location = excluded.location,
+                eventDescription = excluded.eventDescription, organizerName = excluded.organizerName,
+                position = excluded.position, payload = excluded.payload, updatedAt = excluded.updatedAt
+            """,
+            parameters: 11,
+            rows: encoded
+        ) { row, statement in
+            statement.bindString(index: 0, string: row.event._id)
+            statement.bindString(index: 1, string: row.event.name)
+            statement.bindString(index: 2, string: row.event.category)
+            statement.bindBoolean(index: 3, boolean: KotlinBoolean(bool: row.event.isLive))
+            statement.bindString(index: 4, string: row.event.startDate)
+            statement.bindString(index: 5, string: row.event.location)
+            statement.bindString(index: 6, string: row.event.eventDescription)
+            statement.bindString(index: 7, string: row.event.organizerName)
+            statement.bindLong(index: 8, long: KotlinLong(longLong: Int64(row.position)))
+            statement.bindString(index: 9, string: row.payload)
+            statement.bindDouble(index: 10, double: now)
+        }
+    }
+
+    private func selectEvents(_ identifier: Identifier, sql: String, parameters: Int32 = 0, binders: ((RuntimeSqlPreparedStatement) -> Void)? = nil) -> [EventResponse] {
+        let decoder = self.decoder
+        let result = driver.executeQuery(
+            identifier: KotlinInt(int: identifier.rawValue),
+            sql: sql,
+            mapper: { cursor in
+                var events: [EventResponse] = []
+                while (cursor.next().value as? KotlinBoolean)?.boolValue == true {
+                    if let payload = cursor.getString(index: 0)?.data(using: .utf8),
+                       let event = try? decoder.decode(EventResponse.self, from: payload) {
+                        events.append(event)
+                    }
+                }
+                return SQLiteQueryResult(events)
+            },
+            parameters: parameters,
+            binders: binders
+        )
+        return result.value as? [EventResponse] ?? []
+    }
+
+    private func deleteAll(notify: Bool) {
+        _ = driver.execute(identifier: KotlinInt(int: Identifier.deleteAll.rawValue), sql: "DELETE FROM event", parameters: 0, binders: nil)
+        if notify {
+            notifyEventTable()
+        }
+    }
+
+    private func notifyEventTable() {
+        driver.notifyListeners(tables: [EventQueries.tableKey])
+    }
+}
+
+// MARK: - Search Index Backfill
+extension EventQueries {
+    /// Indexes events that were stored before `event_search` existed, a chunk of rowids at a time.
+    /// Each chunk deletes then re-inserts its rowids, so rows the triggers already indexed are not duplicated.
+    struct SearchIndexBackfill: ChunkedMigration {
+        static let migrationId = "event_search_backfill"
+
+        let id = SearchIndexBackfill.migrationId
+        let chunkSize = 500
+
+        func remainingUnits(on driver: RuntimeSqlDriver, after cursor: Int64) -> Int {
+            let result = driver.executeQuery(identifier: nil, sql: "SELECT COUNT(*) FROM event WHERE rowid > ?", mapper: { sqlCursor in
+                let hasRow = (sqlCursor.next().value as? KotlinBoolean)?.boolValue ?? false
+                return SQLiteQueryResult(hasRow ? sqlCursor.getLong(index: 0) : nil)
+            }, parameters: 1) { $0.bindLong(index: 0, long: KotlinLong(longLong: cursor)) }
+            return (result.value as? KotlinLong)?.intValue ?? 0
+        }
+
+        func migrateChunk(on driver: RuntimeSqlDriver, after cursor: Int64, limit: Int) -> (cursor: Int64, processed: Int)? {
+            let bounds = driver.executeQuery(identifier: nil, sql: "SELECT MAX(rowid), COUNT(*) FROM (SELECT rowid FROM event WHERE rowid > ? ORDER BY rowid LIMIT ?)", mapper: { sqlCursor in
+                guard (sqlCursor.next().value as? KotlinBoolean)?.boolValue == true,
+                      let last = sqlCursor.getLong(index: 0)?.int64Value,
+                      let count = sqlCursor.getLong(index: 1)?.intValue else {
+                    return SQLiteQueryResult(nil)
+                }
+                return SQLiteQueryResult((last, count))
+            }, parameters: 2) {
+                $0.bindLong(index: 0, long: KotlinLong(longLong: cursor))
+                $0.bindLong(index: 1, long: KotlinLong(longLong: Int64(limit)))
+            }
+            guard let (last, count) = bounds.value as? (Int64, Int) else { return nil }
+
+            let bindRange: (RuntimeSqlPreparedStatement) -> Void = {
+                $0.bindLong(index: 0, long: KotlinLong(longLong: cursor))
+                $0.bindLong(index: 1, long: KotlinLong(longLong: last))
+            }
+            _ = driver.execute(identifier: nil, sql: "DELETE FROM event_search WHERE rowid > ? AND rowid <= ?", parameters: 2, binders: bindRange)
+            _ = driver.execute(identifier: nil, sql: """
+                INSERT INTO event_search(rowid, name, location, category, eventDescription, organizerName)
+                SELECT rowid, name, location, category, eventDescription, organizerName FROM event WHERE rowid > ? AND rowid <= ?
+                """, parameters: 2, binders: bindRange)
+            return (last, count)
+        }
+    }
+}
@@ -0,0 +1,175 @@
+import Foundation
+import sharedKit
+
+// MARK: - Query Statistics
+/// Per-statement counters collected by `InstrumentedSqlDriver`
+struct QueryStatistics {
+    /// Upper bounds (ms) of the latency histogram buckets; the last bucket is open-ended
+    static let latencyBucketBounds: [Double] = [0.1, 0.5, 1, 5, 10, 50, 100]
+
+    let label: String
+    var executions = 0
+    var rowsReturned = 0
+    var rowsChanged = 0
+    var totalMilliseconds: Double = 0
+    var maxMilliseconds: Double = 0
+    var latencyBuckets = [Int](repeating: 0, count: QueryStatistics.latencyBucketBounds.count + 1)
+
+    var averageMilliseconds: Double {
+        executions == 0 ? 0 : totalMilliseconds / Double(executions)
+    }
+
+    mutating func record(milliseconds: Double) {
+        executions += 1
+        totalMilliseconds += milliseconds
+        maxMilliseconds = max(maxMilliseconds, milliseconds)
+        let bucket = QueryStatistics.latencyBucketBounds.firstIndex { milliseconds < $0 } ?? QueryStatistics.latencyBucketBounds.count
+        latencyBuckets[bucket] += 1
+    }
+}
+
+// MARK: - Instrumented SQL Driver
+/// `RuntimeSqlDriver` decorator that times every statement and counts rows,
+/// keyed by SQLDelight identifier (statements without one are keyed by their SQL).
+/// Cache hit rate comes from the wrapped driver when it reports one.
+final class InstrumentedSqlDriver: NSObject, RuntimeSqlDriver {
+    let base: RuntimeSqlDriver
+    private let lock = NSLock()
+    private var statistics: [String: QueryStatistics] = [:]
+
+    init(wrapping base: RuntimeSqlDriver) {
+        self.base = base
+    }
+
+    // MARK: - Reporting
+
+    /// Snapshot keyed by "#<identifier>" or by the statement's SQL
+    var queryStatistics: [String: QueryStatistics] {
+        lock.lock()
+        defer { lock.unlock() }
+        return statistics
+    }
+
+    func statistics(forIdentifier identifier: Int32) -> QueryStatistics? {
+        queryStatistics["#\(identifier)"]
+    }
+
+    var statementCacheStatistics: StatementCacheStatistics? {
+        (base as? StatementCacheReporting)?.statementCacheStatistics
+    }
+
+    func reset() {
+        lock.lock()
+        statistics.removeAll()
+        lock.unlock()
+    }
+
+    func report() -> String {
+        var lines = ["🗄️ SQL statement metrics:"]
+        if let cache = statementCacheStatistics {
+            lines.append("   statement cache: \(cache.hits) hits, \(cache.misses) misses, \(cache.uncached) uncached (\(String(format: "%.1f", cache.hitRate * 100))% hit rate)")
+        }
+        let bounds = QueryStatistics.latencyBucketBounds.map { "<\($0.formatted())" } + ["≥\(QueryStatistics.latencyBucketBounds.last!.formatted())"]
+        for stats in queryStatistics.values.sorted(by: { $0.totalMilliseconds > $1.totalMilliseconds }) {
+            let histogram = zip(bounds, stats.latencyBuckets).filter { $0.1 > 0 }.map { "\($0.0)ms:\($0.1)" }.joined(separator: " ")
+            lines.append("   \(stats.label) — \(stats.executions)x, avg \(String(format: "%.2f", stats.averageMilliseconds))ms, max \(String(format: "%.2f", stats.maxMilliseconds))ms, rows \(stats.rowsReturned) read / \(stats.rowsChanged) changed [\(histogram)]")
+        }
+        return lines.joined(separator: "\n")
+    }
+
+    func printReport() {
+        print(report())
+    }
+
+    // MARK: - RuntimeSqlDriver
+
+    func execute(identifier: KotlinInt?, sql: String, parameters: Int32, binders: ((RuntimeSqlPreparedStatement) -> Void)?) -> RuntimeQueryResult {
+        let start = CFAbsoluteTimeGetCurrent()
+        let result = base.execute(identifier: identifier, sql: sql, parameters: parameters, binders: binders)
+        let changed = (result.value as? KotlinLong)?.intValue ?? 0
+        record(identifier: identifier, sql: sql, since: start) { $0.rowsChanged += changed }
+        return result
+    }
+
+    func executeQuery(identifier: KotlinInt?, sql: String, mapper: @escaping (RuntimeSqlCursor) -> RuntimeQueryResult, parameters: Int32, binders: ((RuntimeSqlPreparedStatement) -> Void)?) -> RuntimeQueryResult {
+        var rows = 0
+        let start = CFAbsoluteTimeGetCurrent()
+        let result = base.executeQuery(identifier: identifier, sql: sql, mapper: { cursor in
+            let counting = CountingCursor(cursor)
+            defer { rows = counting.rows }
+            return mapper(counting)
+        }, parameters: parameters, binders: binders)
+        record(identifier: identifier, sql: sql, since: start) { $0.rowsReturned += rows }
+        return result
+    }
+
+    func doNewTransaction() -> RuntimeQueryResult {
+        base.doNewTransaction()
+    }
+
+    func currentTransaction() -> RuntimeTransacterTransaction? {
+        base.currentTransaction()
+    }
+
+    func addListener(queryKeys: KotlinArray<NSString>, listener: RuntimeQueryListener) {
+        base.addListener(queryKeys: queryKeys, listener: listener)
+    }
+
+    func removeListener(queryKeys: KotlinArray<NSString>, listener: RuntimeQueryListener) {
+        base.removeListener(queryKeys: queryKeys, listener: listener)
+    }
+
+    func notifyListeners(queryKeys: KotlinArray<NSString>) {
+        base.notifyListeners(queryKeys: queryKeys)
+    }
+
+    func close() {
+        base.close()
+    }
+
+    // MARK: - Private Helpers
+
+    private func record(identifier: KotlinInt?, sql: String, since start: CFAbsoluteTime, update: (inout QueryStatistics) -> Void) {
+        let milliseconds = (CFAbsoluteTimeGetCurrent() - start) * 1000
+        let key = identifier.map { "#\($0.int32Value)" } ?? sql
+        let label = identifier.map { "#\($0.int32Value) \(InstrumentedSqlDriver.summary(of: sql))" } ?? InstrumentedSqlDriver.summary(of: sql)
+
+        lock.lock()
+        defer { lock.unlock() }
+        var stats = statistics[key] ?? QueryStatistics(label: label)
+        stats.record(milliseconds: milliseconds)
+        update(&stats)
+        statistics[key] = stats
+    }
+
+    /// First line of the SQL, whitespace-collapsed and trimmed for reports
+    private static func summary(of sql: String) -> String {
+        let collapsed = sql.split(whereSeparator: \.isWhitespace).joined(separator: " ")
+        return collapsed.count > 60 ? String(collapsed.prefix(60)) + "…" : collapsed
+    }
+}
+
+// MARK: - Counting Cursor
+/// Forwards to the real cursor and counts rows stepped
+private final class CountingCursor: NSObject, RuntimeSqlCursor {
+    private let base: RuntimeSqlCursor
+    private(set) var rows = 0
+
+    init(_ base: RuntimeSqlCursor) {
+        self.base = base
+    }
+
+    func next() -> RuntimeQueryResult {
+        let result = base.next()
+        if (result.value as? KotlinBoolean)?.boolValue == true {
+            rows += 1
+        }
+        return result
+    }
+
+    func getBoolean(index: Int32) -> KotlinBoolean? { base.getBoolean(index: index) }
+    func getBytes(index: Int32) -> KotlinByteArray? { base.getBytes(index: index) }
+    func getDouble(index: Int32) -> KotlinDouble? { base.getDouble(index: index) }
+    func getLong(index: Int32) -> KotlinLong? { base.getLong(index: index) }
+    func getString(index: Int32) -> String? { base.getString(index: index) }
+}
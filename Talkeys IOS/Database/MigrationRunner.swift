@@ -0,0 +1,233 @@
+import Foundation
+import Combine
+import sharedKit
+
+// MARK: - Chunked Migration
+/// A data migration too heavy for the launch path. It walks rows in rowid order,
+/// one chunk per transaction, so it can stop at any point and resume from the saved cursor.
+protocol ChunkedMigration {
+    /// Stable key for the persisted progress row
+    var id: String { get }
+    var chunkSize: Int { get }
+
+    /// Units of work left after `cursor` (used for progress reporting)
+    func remainingUnits(on driver: RuntimeSqlDriver, after cursor: Int64) -> Int
+
+    /// Migrate up to `limit` units after `cursor`.
+    /// - Returns: the new cursor and units processed, or nil when nothing is left
+    func migrateChunk(on driver: RuntimeSqlDriver, after cursor: Int64, limit: Int) -> (cursor: Int64, processed: Int)?
+}
+
+// MARK: - Migration Progress
+struct MigrationProgress {
+    let id: String
+    let processed: Int
+    let total: Int
+    let isComplete: Bool
+    /// Time spent migrating, summed across launches
+    let duration: TimeInterval
+
+    var fraction: Double {
+        total == 0 ? 1 : min(1, Double(processed) / Double(total))
+    }
+}
+
+// MARK: - Migration Runner
+/// Runs registered `ChunkedMigration`s on a utility queue after launch.
+/// Progress lives in the `migration_progress` table and is updated in the same transaction as each chunk.
+final class MigrationRunner {
+    private enum Identifier: Int32 {
+        case selectProgress = 370_001
+        case saveProgress
+    }
+
+    static let schema = """
+        CREATE TABLE IF NOT EXISTS migration_progress (
+            id TEXT NOT NULL PRIMARY KEY,
+            cursor INTEGER NOT NULL,
+            processed INTEGER NOT NULL,
+            total INTEGER NOT NULL,
+            completed INTEGER NOT NULL,
+            duration REAL NOT NULL
+        )
+        """
+
+    private struct SavedState {
+        var cursor: Int64 = 0
+        var processed = 0
+        var total = 0
+        var completed = false
+        var duration: TimeInterval = 0
+    }
+
+    /// Emits after every chunk and once more when a migration completes
+    let progress = PassthroughSubject<MigrationProgress, Never>()
+
+    private let driver: RuntimeSqlDriver
+    private let migrations: [ChunkedMigration]
+    private let queue = DispatchQueue(label: "MigrationRunner", qos: .utility)
+    private let lock = NSLock()
+    private var isRunning = false
+    private var isCancelled = false
+    /// Set when a run is requested while one is still winding down after `cancel()`
+    private var rerunRequested = false
+
+    init(driver: RuntimeSqlDriver, migrations: [ChunkedMigration]) {
+        self.driver = driver
+        self.migrations = migrations
+    }
+
+    static func createSchema(on driver: SQLiteDriver) {
+        driver.exec(schema)
+    }
+
+    // MARK: - Public Methods
+
+    func isComplete(_ id: String) -> Bool {
+        loadState(id).completed
+    }
+
+    func currentProgress(_ id: String) -> MigrationProgress {
+        let state = loadState(id)
+        return MigrationProgress(id: id, processed: state.processed, total: state.total, isComplete: state.completed, duration: state.duration)
+    }
+
+    /// Run pending migrations off the calling thread. A call while running keeps that run going,
+    /// even if it was just cancelled (e.g. the app went to the background and straight back).
+    func runInBackground(completion: (() -> Void)? = nil) {
+        lock.lock()
+        guard !isRunning else {
+            isCancelled = false
+            rerunRequested = true
+            lock.unlock()
+            return
+        }
+        isRunning = true
+        isCancelled = false
+        lock.unlock()
+
+        queue.async { [weak self] in
+            guard let self = self else { return }
+            var runAgain = false
+            repeat {
+                self.runPending()
+                self.lock.lock()
+                // The run may have stopped on a cancel that a later call has since lifted
+                runAgain = self.rerunRequested && !self.isCancelled
+                self.rerunRequested = false
+                if !runAgain {
+                    self.isRunning = false
+                }
+                self.lock.unlock()
+            } while runAgain
+            completion?()
+        }
+    }
+
+    /// Stop after the current chunk; the next run resumes from the saved cursor
+    func cancel() {
+        lock.lock()
+        isCancelled = true
+        lock.unlock()
+    }
+
+    /// Run on the calling thread, stopping after `maxChunks` chunks (simulates an interrupted launch in tests)
+    func runPending(maxChunks: Int = .max) {
+        var chunksLeft = maxChunks
+        for migration in migrations where !isComplete(migration.id) {
+            chunksLeft = run(migration, chunkBudget: chunksLeft)
+            guard chunksLeft > 0, !cancelled else { return }
+        }
+    }
+
+    // MARK: - Private Helpers
+
+    private var cancelled: Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        return isCancelled
+    }
+
+    /// - Returns: chunk budget left over
+    private func run(_ migration: ChunkedMigration, chunkBudget: Int) -> Int {
+        var state = loadState(migration.id)
+        if state.total == 0 {
+            state.total = migration.remainingUnits(on: driver, after: state.cursor) + state.processed
+        }
+        print("🗄️ Migration \(migration.id): starting at \(state.processed)/\(state.total)")
+
+        var budget = chunkBudget
+        while budget > 0 && !cancelled {
+            let start = CFAbsoluteTimeGetCurrent()
+            let finished: Bool
+            do {
+                finished = try driver.checkedTransaction {
+                    guard let chunk = migration.migrateChunk(on: driver, after: state.cursor, limit: migration.chunkSize) else {
+                        state.completed = true
+                        state.duration += CFAbsoluteTimeGetCurrent() - start
+                        saveState(state, for: migration.id)
+                        return true
+                    }
+                    state.cursor = chunk.cursor
+                    state.processed += chunk.processed
+                    state.total = max(state.total, state.processed)
+                    state.duration += CFAbsoluteTimeGetCurrent() - start
+                    saveState(state, for: migration.id)
+                    return false
+                }
+            } catch {
+                // The chunk rolled back; the next run resumes from the last saved cursor
+                print("❌ Migration \(migration.id): chunk failed, stopping: \(error)")
+                break
+            }
+            budget -= 1
+
+            progress.send(MigrationProgress(id: migration.id, processed: state.processed, total: state.total, isComplete: finished, duration: state.duration))
+            if finished {
+                print("✅ Migration \(migration.id): \(state.processed) rows in \(String(format: "%.1f", state.duration * 1000))ms")
+                break
+            }
+        }
+        return budget
+    }
+
+    private func loadState(_ id: String) -> SavedState {
+        let result = driver.executeQuery(
+            identifier: KotlinInt(int: Identifier.selectProgress.rawValue),
+            sql: "SELECT cursor, processed, total, completed, duration FROM migration_progress WHERE id = ?",
+            mapper: { cursor in
+                guard (cursor.next().value as? KotlinBoolean)?.boolValue == true else {
+                    return SQLiteQueryResult(nil)
+                }
+                return SQLiteQueryResult(SavedState(
+                    cursor: cursor.getLong(index: 0)?.int64Value ?? 0,
+                    processed: cursor.getLong(index: 1)?.intValue ?? 0,
+                    total: cursor.getLong(index: 2)?.intValue ?? 0,
+                    completed: cursor.getBoolean(index: 3)?.boolValue ?? false,
+                    duration: cursor.getDouble(index: 4)?.doubleValue ?? 0
+                ))
+            },
+            parameters: 1
+        ) { $0.bindString(index: 0, string: id) }
+        return result.value as? SavedState ?? SavedState()
+    }
+
+    private func saveState(_ state: SavedState, for id: String) {
+        _ = driver.execute(
+            identifier: KotlinInt(int: Identifier.saveProgress.rawValue),
+            sql: """
+            INSERT INTO migration_progress(id, cursor, processed, total, completed, duration) VALUES (?, ?, ?, ?, ?, ?)
+            ON CONFLICT(id) DO UPDATE SET cursor = excluded.cursor, processed = excluded.processed,
+                total = excluded.total, completed = excluded.completed, duration = excluded.duration
+            """,
+            parameters: 6
+        ) { statement in
+            statement.bindString(index: 0, string: id)
+            statement.bindLong(index: 1, long: KotlinLong(longLong: state.cursor))
+            statement.bindLong(index: 2, long: KotlinLong(longLong: Int64(state.processed)))
+            statement.bindLong(index: 3, long: KotlinLong(longLong: Int64(state.total)))
+            statement.bindBoolean(index: 4, boolean: KotlinBoolean(bool: state.completed))
+            statement.bindDouble(index: 5, double: KotlinDouble(double: state.duration))
+        }
+    }
+}
@@ -0,0 +1,154 @@
+import Foundation
+import sharedKit
+
+// MARK: - Query Changes
+/// Bridges SQLDelight's `RuntimeQueryListener` notifications to Swift `AsyncStream`s.
+/// Each stream yields the query's current result immediately, then again whenever its tables change.
+enum QueryChanges {
+    /// Notifications closer together than this are folded into one re-query
+    static let defaultCoalescingInterval: TimeInterval = 0.05
+
+    /// Observe a generated SQLDelight query, e.g. `userQueries.selectById(id:)`
+    static func stream<Row: AnyObject, Value>(
+        of query: RuntimeQuery<Row>,
+        coalescingInterval: TimeInterval = defaultCoalescingInterval,
+        scheduler: CoalescingScheduler = DispatchCoalescingScheduler(),
+        transform: @escaping (RuntimeQuery<Row>) -> Value
+    ) -> AsyncStream<Value> {
+        stream(
+            coalescingInterval: coalescingInterval,
+            scheduler: scheduler,
+            register: { query.addListener(listener: $0) },
+            unregister: { query.removeListener(listener: $0) },
+            fetch: { transform(query) as Value? }
+        )
+    }
+
+    /// Observe hand-written queries by the table keys their writes notify (e.g. `EventQueries.tableKey`)
+    static func stream<Value>(
+        driver: RuntimeSqlDriver,
+        tables: [String],
+        coalescingInterval: TimeInterval = defaultCoalescingInterval,
+        scheduler: CoalescingScheduler = DispatchCoalescingScheduler(),
+        fetch: @escaping () -> Value
+    ) -> AsyncStream<Value> {
+        let queryKeys = KotlinArray<NSString>(size: Int32(tables.count)) { tables[$0.intValue] as NSString }
+        return stream(
+            coalescingInterval: coalescingInterval,
+            scheduler: scheduler,
+            register: { driver.addListener(queryKeys: queryKeys, listener: $0) },
+            unregister: { driver.removeListener(queryKeys: queryKeys, listener: $0) },
+            fetch: { fetch() as Value? }
+        )
+    }
+
+    /// Like `stream(driver:tables:)`, for an object that owns the queries: `owner` isn't retained,
+    /// and the stream finishes at the first change after it is gone
+    static func stream<Owner: AnyObject, Value>(
+        driver: RuntimeSqlDriver,
+        tables: [String],
+        owner: Owner,
+        coalescingInterval: TimeInterval = defaultCoalescingInterval,
+        scheduler: CoalescingScheduler = DispatchCoalescingScheduler(),
+        fetch: @escaping (Owner) -> Value
+    ) -> AsyncStream<Value> {
+        let queryKeys = KotlinArray<NSString>(size: Int32(tables.count)) { tables[$0.intValue] as NSString }
+        return stream(
+            coalescingInterval: coalescingInterval,
+            scheduler: scheduler,
+            register: { driver.addListener(queryKeys: queryKeys, listener: $0) },
+            unregister: { driver.removeListener(queryKeys: queryKeys, listener: $0) },
+            fetch: { [weak owner] in owner.map(fetch) }
+        )
+    }
+
+    /// `fetch` returning nil finishes the stream
+    private static func stream<Value>(
+        coalescingInterval: TimeInterval,
+        scheduler: CoalescingScheduler,
+        register: @escaping (RuntimeQueryListener) -> Void,
+        unregister: @escaping (RuntimeQueryListener) -> Void,
+        fetch: @escaping () -> Value?
+    ) -> AsyncStream<Value> {
+        AsyncStream(bufferingPolicy: .bufferingNewest(1)) { continuation in
+            let listener = CoalescingQueryListener(interval: coalescingInterval, scheduler: scheduler) {
+                guard let value = fetch() else {
+                    continuation.finish()
+                    return
+                }
+                continuation.yield(value)
+            }
+            continuation.onTermination = { _ in
+                unregister(listener)
+                listener.cancel()
+            }
+            register(listener)
+            listener.queryResultsChanged()
+        }
+    }
+}
+
+// MARK: - Coalescing Scheduler
+/// Closes a coalescing window after its interval; tests substitute one they advance by hand
+protocol CoalescingScheduler {
+    func schedule(after interval: TimeInterval, _ body: @escaping () -> Void)
+}
+
+struct DispatchCoalescingScheduler: CoalescingScheduler {
+    func schedule(after interval: TimeInterval, _ body: @escaping () -> Void) {
+        DispatchQueue.global(qos: .userInitiated).asyncAfter(deadline: .now() + interval, execute: body)
+    }
+}
+
+// MARK: - Coalescing Listener
+/// Re-queries on the first notification right away, then at most once per interval
+/// while notifications keep arriving (a bulk sync fires one per statement or transaction).
+final class CoalescingQueryListener: NSObject, RuntimeQueryListener {
+    private let queue = DispatchQueue(label: "QueryChanges", qos: .userInitiated)
+    private let interval: TimeInterval
+    private let scheduler: CoalescingScheduler
+    private let onChange: () -> Void
+
+    // Only touched on `queue`
+    private var windowOpen = false
+    private var changedDuringWindow = false
+    private var cancelled = false
+
+    init(interval: TimeInterval, scheduler: CoalescingScheduler = DispatchCoalescingScheduler(), onChange: @escaping () -> Void) {
+        self.interval = interval
+        self.scheduler = scheduler
+        self.onChange = onChange
+    }
+
+    func queryResultsChanged() {
+        queue.async { [self] in
+            guard !cancelled else { return }
+            if windowOpen {
+                changedDuringWindow = true
+            } else {
+                flush()
+            }
+        }
+    }
+
+    func cancel() {
+        queue.async { [self] in
+            cancelled = true
+        }
+    }
+
+    private func flush() {
+        onChange()
+        windowOpen = true
+        scheduler.schedule(after: interval) { [self] in
+            // Queued behind any notifications that arrived before the window closed
+            queue.async {
+                windowOpen = false
+                if changedDuringWindow && !cancelled {
+                    changedDuringWindow = false
+                    flush()
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,243 @@
+import Foundation
+import SQLite3
+import sharedKit
+
+// MARK: - SQLite Configuration
+/// Journal mode and pragmas applied to every connection the driver opens
+struct SQLiteConfiguration {
+    /// WAL lets readers run against the last commit while a write transaction is open
+    var walEnabled = true
+    /// NORMAL is durable across app crashes in WAL mode; only an OS crash can drop the last commit
+    var synchronous = "NORMAL"
+    /// Page cache per connection, in KiB
+    var cacheSizeKiB = 8 * 1024
+    /// Memory-mapped I/O window for reads, in bytes
+    var mmapSize = 64 * 1024 * 1024
+    /// Read-only connections in the pool (file databases only)
+    var readerCount = 3
+    var busyTimeoutMilliseconds: Int32 = 5_000
+
+    static let `default` = SQLiteConfiguration()
+
+    /// SQLite's own defaults on a single connection; the baseline for benchmarks
+    static let unpooled = SQLiteConfiguration(walEnabled: false, synchronous: "FULL", cacheSizeKiB: 2_000, mmapSize: 0, readerCount: 0)
+}
+
+// MARK: - SQLite Error
+/// A failed open, prepare or step, with SQLite's result code and message
+struct SQLiteError: Error, CustomStringConvertible {
+    let code: Int32
+    let message: String
+    let sql: String
+
+    var description: String {
+        sql.isEmpty ? "SQLite error \(code): \(message)" : "SQLite error \(code): \(message)\n   \(sql)"
+    }
+}
+
+// MARK: - SQLite Connection
+/// One SQLite handle with its own prepared-statement cache.
+/// Not thread-safe: the driver serializes the writer and the pool hands each reader to one caller at a time.
+final class SQLiteConnection {
+    private(set) var handle: OpaquePointer?
+    private var statementCache: [Int32: OpaquePointer] = [:]
+    private let cacheCounter: StatementCacheCounter?
+    /// Why the handle couldn't be opened; nil once open
+    private(set) var openError: SQLiteError?
+
+    init(path: String, readOnly: Bool, cacheCounter: StatementCacheCounter? = nil) {
+        self.cacheCounter = cacheCounter
+        let access = readOnly ? SQLITE_OPEN_READONLY : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE)
+        let code = sqlite3_open_v2(path, &handle, access | SQLITE_OPEN_NOMUTEX, nil)
+        if code != SQLITE_OK {
+            openError = SQLiteError(code: code, message: errorMessage, sql: "")
+            print("❌ Failed to open database at \(path): \(errorMessage)")
+            // SQLite allocates a handle even on failure; it is only good for reading the error
+            sqlite3_close_v2(handle)
+            handle = nil
+        }
+    }
+
+    var isOpen: Bool {
+        handle != nil
+    }
+
+    deinit {
+        close()
+    }
+
+    /// Apply journal mode and pragmas; journal_mode is persistent, so only the writer sets it
+    func apply(_ configuration: SQLiteConfiguration, isWriter: Bool) throws {
+        if let openError = openError {
+            throw openError
+        }
+        sqlite3_busy_timeout(handle, configuration.busyTimeoutMilliseconds)
+        if isWriter && configuration.walEnabled {
+            try exec("PRAGMA journal_mode = WAL")
+        }
+        try exec("PRAGMA synchronous = \(configuration.synchronous)")
+        try exec("PRAGMA cache_size = -\(configuration.cacheSizeKiB)")
+        try exec("PRAGMA mmap_size = \(configuration.mmapSize)")
+        try exec("PRAGMA temp_store = MEMORY")
+        if !isWriter {
+            try exec("PRAGMA query_only = 1")
+        }
+    }
+
+    // MARK: - Statements
+
+    func prepare(identifier: KotlinInt?, sql: String) throws -> OpaquePointer {
+        if let identifier = identifier?.int32Value, let cached = statementCache[identifier] {
+            cacheCounter?.record(.hit)
+            return cached
+        }
+        cacheCounter?.record(identifier == nil ? .uncached : .miss)
+
+        var statement: OpaquePointer?
+        let code = sqlite3_prepare_v2(handle, sql, -1, &statement, nil)
+        guard code == SQLITE_OK, let statement = statement else {
+            throw SQLiteError(code: code == SQLITE_OK ? SQLITE_MISUSE : code, message: errorMessage, sql: sql)
+        }
+
+        if let identifier = identifier?.int32Value {
+            statementCache[identifier] = statement
+        }
+        return statement
+    }
+
+    /// Cached statements are reset for reuse; one-off statements are finalized
+    func release(_ statement: OpaquePointer, identifier: KotlinInt?) {
+        if identifier != nil {
+            sqlite3_reset(statement)
+            sqlite3_clear_bindings(statement)
+        } else {
+            sqlite3_finalize(statement)
+        }
+    }
+
+    /// Step a write statement to completion, discarding any rows it returns
+    func run(_ statement: OpaquePointer, sql: String) throws {
+        var code = sqlite3_step(statement)
+        while code == SQLITE_ROW {
+            code = sqlite3_step(statement)
+        }
+        guard code == SQLITE_DONE else {
+            throw SQLiteError(code: code, message: errorMessage, sql: sql)
+        }
+    }
+
+    func exec(_ sql: String) throws {
+        let code = sqlite3_exec(handle, sql, nil, nil, nil)
+        guard code == SQLITE_OK else {
+            throw SQLiteError(code: code, message: errorMessage, sql: sql)
+        }
+    }
+
+    var changes: Int64 {
+        Int64(sqlite3_changes(handle))
+    }
+
+    var errorMessage: String {
+        handle.flatMap { sqlite3_errmsg($0) }.map { String(cString: $0) } ?? "unknown error"
+    }
+
+    func close() {
+        statementCache.values.forEach { sqlite3_finalize($0) }
+        statementCache.removeAll()
+        if handle != nil {
+            sqlite3_close_v2(handle)
+            handle = nil
+        }
+    }
+}
+
+// MARK: - Reader Pool
+/// Fixed set of read-only connections; callers block only when every reader is busy
+final class SQLiteReaderPool {
+    private var idle: [SQLiteConnection]
+    private let lock = NSLock()
+    private let available: DispatchSemaphore
+    let size: Int
+
+    init(path: String, configuration: SQLiteConfiguration, cacheCounter: StatementCacheCounter? = nil) {
+        // A reader that can't open or isn't query_only is dropped rather than handed out
+        idle = (0..<configuration.readerCount).compactMap { _ in
+            let connection = SQLiteConnection(path: path, readOnly: true, cacheCounter: cacheCounter)
+            do {
+                try connection.apply(configuration, isWriter: false)
+                return connection
+            } catch {
+                print("❌ Dropping reader connection: \(error)")
+                return nil
+            }
+        }
+        size = idle.count
+        available = DispatchSemaphore(value: idle.count)
+    }
+
+    func withConnection<T>(_ body: (SQLiteConnection) -> T) -> T {
+        available.wait()
+        lock.lock()
+        let connection = idle.removeLast()
+        lock.unlock()
+
+        defer {
+            lock.lock()
+            idle.append(connection)
+            lock.unlock()
+            available.signal()
+        }
+        return body(connection)
+    }
+
+    func close() {
+        lock.lock()
+        defer { lock.unlock() }
+        idle.forEach { $0.close() }
+    }
+}
+
+// MARK: - Statement Cache Statistics
+struct StatementCacheStatistics {
+    /// Identifier-keyed statement found already prepared
+    var hits = 0
+    /// Identifier-keyed statement prepared for the first time on a connection
+    var misses = 0
+    /// Statement without an identifier, prepared and finalized every time
+    var uncached = 0
+
+    var hitRate: Double {
+        let total = hits + misses + uncached
+        return total == 0 ? 0 : Double(hits) / Double(total)
+    }
+}
+
+protocol StatementCacheReporting: AnyObject {
+    var statementCacheStatistics: StatementCacheStatistics { get }
+}
+
+/// Shared by all of a driver's connections; readers record from whichever thread holds them
+final class StatementCacheCounter {
+    enum Outcome {
+        case hit, miss, uncached
+    }
+
+    private let lock = NSLock()
+    private var current = StatementCacheStatistics()
+
+    func record(_ outcome: Outcome) {
+        lock.lock()
+        defer { lock.unlock() }
+        switch outcome {
+        case .hit: current.hits += 1
+        case .miss: current.misses += 1
+        case .uncached: current.uncached += 1
+        }
+    }
+
+    var statistics: StatementCacheStatistics {
+        lock.lock()
+        defer { lock.unlock() }
+        return current
+    }
+}
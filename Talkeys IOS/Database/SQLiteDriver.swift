@@ -0,0 +1,449 @@
+import Foundation
+import SQLite3
+import sharedKit
+
+private let SQLITE_TRANSIENT = unsafeBitCast(-1, to: sqlite3_destructor_type.self)
+
+// MARK: - SQLite Driver
+/// Swift implementation of SQLDelight's `RuntimeSqlDriver` on top of the system SQLite library.
+/// sharedKit exports the generated `TalkeysDatabase` and `UserQueries` but no native driver factory,
+/// so the app provides its own. Statements with a SQLDelight identifier are prepared once and reused.
+///
+/// Writes and transactions go through one writer connection. In WAL mode, queries outside the
+/// calling thread's own transaction run on a pool of read-only connections, so UI reads don't
+/// queue behind a sync's bulk write.
+///
+/// `RuntimeSqlDriver` can't throw, so a failed statement is recorded in `lastError` and fails the
+/// open transaction: the rest of its writes are skipped and it rolls back instead of committing.
+final class SQLiteDriver: NSObject, RuntimeSqlDriver, StatementCacheReporting {
+    let configuration: SQLiteConfiguration
+    private let cacheCounter = StatementCacheCounter()
+    private let writer: SQLiteConnection
+    private let readers: SQLiteReaderPool?
+    private let lock = NSRecursiveLock()
+
+    private var listeners: [String: [RuntimeQueryListener]] = [:]
+    private var openTransaction: Transaction?
+
+    /// Guarded separately so reader failures don't wait on the writer lock
+    private let errorLock = NSLock()
+    private var recordedError: SQLiteError?
+
+    /// Guarded separately so a reader can check it without waiting on the writer lock
+    private let transactionThreadLock = NSLock()
+    private var transactionThread: Thread?
+
+    /// - Parameters:
+    ///   - path: database file path, or ":memory:" for a throwaway database (no reader pool)
+    ///   - configuration: journal mode, pragmas and reader count
+    init(path: String, configuration: SQLiteConfiguration = .default) {
+        self.configuration = configuration
+        writer = SQLiteConnection(path: path, readOnly: false, cacheCounter: cacheCounter)
+        var setupError: SQLiteError?
+        do {
+            try writer.apply(configuration, isWriter: true)
+        } catch {
+            setupError = error as? SQLiteError
+        }
+
+        let canPoolReaders = writer.isOpen && path != ":memory:" && configuration.walEnabled && configuration.readerCount > 0
+        let pool = canPoolReaders ? SQLiteReaderPool(path: path, configuration: configuration, cacheCounter: cacheCounter) : nil
+        readers = (pool?.size ?? 0) > 0 ? pool : nil
+        super.init()
+
+        if let setupError = setupError {
+            record(setupError)
+        }
+    }
+
+    deinit {
+        close()
+    }
+
+    /// Number of pooled read-only connections (0 when reads share the writer)
+    var readerCount: Int {
+        readers?.size ?? 0
+    }
+
+    /// Most recent failed open, prepare or statement on any connection
+    var lastError: SQLiteError? {
+        errorLock.lock()
+        defer { errorLock.unlock() }
+        return recordedError
+    }
+
+    /// Prepared-statement cache outcomes across the writer and every reader
+    var statementCacheStatistics: StatementCacheStatistics {
+        cacheCounter.statistics
+    }
+
+    /// Current `PRAGMA journal_mode` on the writer
+    var journalMode: String {
+        let result = onWriter { connection in
+            runQuery(on: connection, identifier: nil, sql: "PRAGMA journal_mode", parameters: 0, binders: nil) { cursor in
+                let hasRow = (cursor.next().value as? KotlinBoolean)?.boolValue ?? false
+                return SQLiteQueryResult(hasRow ? cursor.getString(index: 0) : nil)
+            }
+        }
+        return (result.value as? String) ?? ""
+    }
+
+    // MARK: - RuntimeSqlDriver
+
+    /// - Returns: rows changed by this statement; 0 when it or its transaction failed
+    func execute(identifier: KotlinInt?, sql: String, parameters: Int32, binders: ((RuntimeSqlPreparedStatement) -> Void)?) -> RuntimeQueryResult {
+        onWriter { connection in
+            // A failed transaction only rolls back from here; don't let later writes land in autocommit
+            guard openTransaction?.failure == nil else {
+                return SQLiteQueryResult(KotlinLong(longLong: 0))
+            }
+            do {
+                let statement = try connection.prepare(identifier: identifier, sql: sql)
+                defer { connection.release(statement, identifier: identifier) }
+
+                binders?(SQLitePreparedStatement(statement: statement))
+                try connection.run(statement, sql: sql)
+                return SQLiteQueryResult(KotlinLong(longLong: connection.changes))
+            } catch {
+                fail(error)
+                return SQLiteQueryResult(KotlinLong(longLong: 0))
+            }
+        }
+    }
+
+    func executeQuery(identifier: KotlinInt?, sql: String, mapper: @escaping (RuntimeSqlCursor) -> RuntimeQueryResult, parameters: Int32, binders: ((RuntimeSqlPreparedStatement) -> Void)?) -> RuntimeQueryResult {
+        // Inside our own transaction we must see uncommitted writes, so stay on the writer
+        if let readers = readers, !ownsTransaction {
+            return readers.withConnection { connection in
+                runQuery(on: connection, identifier: identifier, sql: sql, parameters: parameters, binders: binders, mapper: mapper)
+            }
+        }
+        return onWriter { connection in
+            runQuery(on: connection, identifier: identifier, sql: sql, parameters: parameters, binders: binders, mapper: mapper)
+        }
+    }
+
+    /// The lock stays held until the transaction ends, so other threads' statements
+    /// can't interleave with it. A lock can only be released by the thread that took it,
+    /// so the transaction must end on the thread that began it: keep the body synchronous,
+    /// with no `await` between begin and end.
+    func doNewTransaction() -> RuntimeQueryResult {
+        lock.lock()
+
+        let enclosing = openTransaction
+        let newTransaction = Transaction(driver: self, enclosing: enclosing)
+        newTransaction.failure = enclosing?.failure
+        if enclosing == nil {
+            do {
+                try writer.exec("BEGIN IMMEDIATE TRANSACTION")
+                newTransaction.began = true
+            } catch {
+                record(error)
+                newTransaction.failure = error as? SQLiteError
+            }
+            setTransactionThread(.current)
+        }
+        openTransaction = newTransaction
+        return SQLiteQueryResult(newTransaction)
+    }
+
+    func currentTransaction() -> RuntimeTransacterTransaction? {
+        lock.lock()
+        defer { lock.unlock() }
+        return openTransaction
+    }
+
+    func addListener(queryKeys: KotlinArray<NSString>, listener: RuntimeQueryListener) {
+        lock.lock()
+        defer { lock.unlock() }
+        for key in SQLiteDriver.keys(of: queryKeys) {
+            listeners[key, default: []].append(listener)
+        }
+    }
+
+    func removeListener(queryKeys: KotlinArray<NSString>, listener: RuntimeQueryListener) {
+        lock.lock()
+        defer { lock.unlock() }
+        for key in SQLiteDriver.keys(of: queryKeys) {
+            listeners[key]?.removeAll { $0 === listener }
+        }
+    }
+
+    func notifyListeners(queryKeys: KotlinArray<NSString>) {
+        lock.lock()
+        var toNotify: [RuntimeQueryListener] = []
+        for key in SQLiteDriver.keys(of: queryKeys) {
+            for listener in listeners[key] ?? [] where !toNotify.contains(where: { $0 === listener }) {
+                toNotify.append(listener)
+            }
+        }
+        lock.unlock()
+
+        toNotify.forEach { $0.queryResultsChanged() }
+    }
+
+    func close() {
+        lock.lock()
+        defer { lock.unlock() }
+        readers?.close()
+        writer.close()
+    }
+
+    // MARK: - Helpers
+
+    /// Run raw SQL (schema, pragmas) on the writer, outside the statement cache.
+    /// A failure is recorded like a failed `execute`.
+    @discardableResult
+    func exec(_ sql: String) -> Bool {
+        onWriter { connection in
+            do {
+                try connection.exec(sql)
+                return true
+            } catch {
+                fail(error)
+                return false
+            }
+        }
+    }
+
+    /// Read `PRAGMA user_version`, which tracks the SQLDelight schema version
+    var userVersion: Int64 {
+        get {
+            let result = executeQuery(identifier: nil, sql: "PRAGMA user_version", mapper: { cursor in
+                let hasRow = (cursor.next().value as? KotlinBoolean)?.boolValue ?? false
+                return SQLiteQueryResult(hasRow ? cursor.getLong(index: 0) : nil)
+            }, parameters: 0, binders: nil)
+            return (result.value as? KotlinLong)?.int64Value ?? 0
+        }
+        set {
+            exec("PRAGMA user_version = \(newValue)")
+        }
+    }
+
+    /// Balances the lock taken in `doNewTransaction()`.
+    /// A nested transaction that failed or was abandoned fails its enclosing one, as in SQLDelight.
+    fileprivate func endTransaction(_ ending: Transaction, successful: Bool) {
+        precondition(ending.owner == Thread.current, "SQLite transaction ended on a different thread than it began on")
+        precondition(ending === openTransaction, "SQLite transaction ended while a nested transaction was still open")
+        defer { lock.unlock() }
+        if !successful && ending.failure == nil {
+            ending.rolledBack = true
+        }
+
+        if let enclosing = ending.enclosing {
+            if ending.failure != nil || ending.rolledBack {
+                enclosing.failure = enclosing.failure ?? ending.failure
+                enclosing.rolledBack = enclosing.rolledBack || ending.rolledBack
+            }
+        } else {
+            if ending.began {
+                finish(ending)
+            }
+            setTransactionThread(nil)
+        }
+        openTransaction = ending.enclosing
+    }
+
+    /// COMMIT a clean transaction; ROLLBACK a failed one, or one whose COMMIT failed
+    private func finish(_ transaction: Transaction) {
+        if transaction.failure == nil && !transaction.rolledBack {
+            do {
+                try writer.exec("COMMIT TRANSACTION")
+                return
+            } catch {
+                record(error)
+                transaction.failure = error as? SQLiteError
+            }
+        }
+        do {
+            try writer.exec("ROLLBACK TRANSACTION")
+        } catch {
+            // SQLite already rolled back on its own (e.g. SQLITE_FULL); nothing is left open
+            record(error)
+        }
+    }
+
+    /// Record a writer-side failure and fail the open transaction; call with `lock` held
+    private func fail(_ error: Error) {
+        record(error)
+        if let transaction = openTransaction, transaction.failure == nil {
+            transaction.failure = error as? SQLiteError
+        }
+    }
+
+    private func record(_ error: Error) {
+        print("❌ \(error)")
+        guard let error = error as? SQLiteError else { return }
+        errorLock.lock()
+        recordedError = error
+        errorLock.unlock()
+    }
+
+    /// True when the calling thread has an open transaction on the writer.
+    /// Reliable because a transaction is pinned to the thread that began it.
+    private var ownsTransaction: Bool {
+        transactionThreadLock.lock()
+        defer { transactionThreadLock.unlock() }
+        return transactionThread == Thread.current
+    }
+
+    private func setTransactionThread(_ thread: Thread?) {
+        transactionThreadLock.lock()
+        transactionThread = thread
+        transactionThreadLock.unlock()
+    }
+
+    private func onWriter<T>(_ body: (SQLiteConnection) -> T) -> T {
+        lock.lock()
+        defer { lock.unlock() }
+        return body(writer)
+    }
+
+    private func runQuery(on connection: SQLiteConnection, identifier: KotlinInt?, sql: String, parameters: Int32, binders: ((RuntimeSqlPreparedStatement) -> Void)?, mapper: (RuntimeSqlCursor) -> RuntimeQueryResult) -> RuntimeQueryResult {
+        let statement: OpaquePointer
+        do {
+            statement = try connection.prepare(identifier: identifier, sql: sql)
+        } catch {
+            record(error)
+            return mapper(SQLiteCursor(statement: nil))
+        }
+        defer { connection.release(statement, identifier: identifier) }
+
+        binders?(SQLitePreparedStatement(statement: statement))
+        return mapper(SQLiteCursor(statement: statement))
+    }
+
+    /// Query keys passed in by SQLDelight as Swift strings
+    static func keys(of queryKeys: KotlinArray<NSString>) -> [String] {
+        (0..<queryKeys.size).compactMap { queryKeys.get(index: $0) as String? }
+    }
+
+    // MARK: - Transaction
+
+    final class Transaction: RuntimeTransacterTransaction {
+        fileprivate let enclosing: Transaction?
+        private weak var driver: SQLiteDriver?
+        /// The thread holding the writer lock for it; only this thread may end it
+        fileprivate let owner = Thread.current
+        /// BEGIN succeeded, so COMMIT or ROLLBACK is owed (outermost transaction only)
+        fileprivate var began = false
+        /// Ended unsuccessfully by its caller or a nested transaction
+        fileprivate(set) var rolledBack = false
+        /// The first statement that failed inside it; the transaction rolls back instead of committing
+        fileprivate(set) var failure: SQLiteError?
+
+        fileprivate init(driver: SQLiteDriver, enclosing: Transaction?) {
+            self.driver = driver
+            self.enclosing = enclosing
+            super.init()
+        }
+
+        override var enclosingTransaction: RuntimeTransacterTransaction? {
+            enclosing
+        }
+
+        override func endTransaction(successful: Bool) -> RuntimeQueryResult {
+            driver?.endTransaction(self, successful: successful)
+            return SQLiteQueryResult(KotlinUnit())
+        }
+    }
+}
+
+// MARK: - Query Result
+/// Synchronous `QueryResult.Value` equivalent
+final class SQLiteQueryResult: NSObject, RuntimeQueryResult {
+    let value: Any?
+
+    init(_ value: Any?) {
+        self.value = value
+    }
+
+    func `await`(completionHandler: @escaping (Any?, Error?) -> Void) {
+        completionHandler(value, nil)
+    }
+}
+
+// MARK: - Prepared Statement
+/// SQLDelight binds with 0-based indices; SQLite's are 1-based
+final class SQLitePreparedStatement: NSObject, RuntimeSqlPreparedStatement {
+    private let statement: OpaquePointer
+
+    init(statement: OpaquePointer) {
+        self.statement = statement
+    }
+
+    func bindBoolean(index: Int32, boolean: KotlinBoolean?) {
+        guard let boolean = boolean else { sqlite3_bind_null(statement, index + 1); return }
+        sqlite3_bind_int64(statement, index + 1, boolean.boolValue ? 1 : 0)
+    }
+
+    func bindBytes(index: Int32, bytes: KotlinByteArray?) {
+        guard let bytes = bytes else { sqlite3_bind_null(statement, index + 1); return }
+        let data = (0..<bytes.size).map { UInt8(bitPattern: bytes.get(index: $0)) }
+        sqlite3_bind_blob(statement, index + 1, data, Int32(data.count), SQLITE_TRANSIENT)
+    }
+
+    func bindDouble(index: Int32, double: KotlinDouble?) {
+        guard let double = double else { sqlite3_bind_null(statement, index + 1); return }
+        sqlite3_bind_double(statement, index + 1, double.doubleValue)
+    }
+
+    func bindLong(index: Int32, long: KotlinLong?) {
+        guard let long = long else { sqlite3_bind_null(statement, index + 1); return }
+        sqlite3_bind_int64(statement, index + 1, long.int64Value)
+    }
+
+    func bindString(index: Int32, string: String?) {
+        guard let string = string else { sqlite3_bind_null(statement, index + 1); return }
+        sqlite3_bind_text(statement, index + 1, string, -1, SQLITE_TRANSIENT)
+    }
+}
+
+// MARK: - Cursor
+final class SQLiteCursor: NSObject, RuntimeSqlCursor {
+    private let statement: OpaquePointer?
+
+    init(statement: OpaquePointer?) {
+        self.statement = statement
+    }
+
+    func next() -> RuntimeQueryResult {
+        guard let statement = statement else { return SQLiteQueryResult(KotlinBoolean(bool: false)) }
+        return SQLiteQueryResult(KotlinBoolean(bool: sqlite3_step(statement) == SQLITE_ROW))
+    }
+
+    func getBoolean(index: Int32) -> KotlinBoolean? {
+        guard !isNull(index) else { return nil }
+        return KotlinBoolean(bool: sqlite3_column_int64(statement, index) != 0)
+    }
+
+    func getBytes(index: Int32) -> KotlinByteArray? {
+        guard !isNull(index), let blob = sqlite3_column_blob(statement, index) else { return nil }
+        let count = sqlite3_column_bytes(statement, index)
+        let pointer = blob.assumingMemoryBound(to: Int8.self)
+        let bytes = KotlinByteArray(size: count)
+        for offset in 0..<count {
+            bytes.set(index: offset, value: pointer[Int(offset)])
+        }
+        return bytes
+    }
+
+    func getDouble(index: Int32) -> KotlinDouble? {
+        guard !isNull(index) else { return nil }
+        return KotlinDouble(double: sqlite3_column_double(statement, index))
+    }
+
+    func getLong(index: Int32) -> KotlinLong? {
+        guard !isNull(index) else { return nil }
+        return KotlinLong(longLong: sqlite3_column_int64(statement, index))
+    }
+
+    func getString(index: Int32) -> String? {
+        guard !isNull(index), let text = sqlite3_column_text(statement, index) else { return nil }
+        return String(cString: text)
+    }
+
+    private func isNull(_ index: Int32) -> Bool {
+        statement == nil || sqlite3_column_type(statement, index) == SQLITE_NULL
+    }
+}
@@ -4,7 +4,7 @@ import sharedKit
 struct HomeScreen: View {
     @Binding var isLoggedIn: Bool
     @State private var showingProfile = false
-    @State private var currentUser: User?
+    @State private var currentUser: AppUser?
     @State private var isSigningOut = false
     
     // Get user info from shared KMP logic
@@ -13,17 +13,8 @@ struct HomeScreen: View {
     init(isLoggedIn: Binding<Bool>) {
         self._isLoggedIn = isLoggedIn
         
-        // Initialize shared KMP authentication to get user data
-        SharedModuleInitializerKt.doInitKoin()
-        let apiClient = ApiClient()
-        let googleSignInProvider = IOSGoogleSignInProvider()
-        let tokenStorage = IOSTokenStorage()
-        
-        self.authRepository = AuthRepository(
-            httpClient: apiClient.httpClient,
-            googleSignInProvider: googleSignInProvider,
-            tokenStorage: tokenStorage
-        )
+        // Shared KMP authentication to get user data
+        self.authRepository = AppContainer.shared.authRepository
     }
     
     var body: some View {
@@ -182,7 +173,7 @@ struct HomeScreen: View {
                 
                 await MainActor.run {
                     if let successState = authState as? AuthState.Success {
-                        self.currentUser = successState.user
+                        self.currentUser = AppUser(successState.user)
                     }
                 }
             } catch {
@@ -315,7 +306,7 @@ struct ActivityRow: View {
 }
 
 struct ProfileSheet: View {
-    let user: User?
+    let user: AppUser?
     @Environment(\.dismiss) private var dismiss
     
     var body: some View {
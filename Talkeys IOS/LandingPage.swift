@@ -1,10 +1,9 @@
 import SwiftUI
 import GoogleSignIn
-import sharedKit
 
 struct LandingPage: View {
     // MARK: - MVVM Properties
-    @StateObject private var authViewModel = AuthViewModel()
+    @ObservedObject private var authViewModel = AppContainer.shared.authViewModel
     
     // Navigation
     @Binding var isLoggedIn: Bool
@@ -132,63 +131,51 @@ struct LandingPage: View {
 
 class TokenManager {
     static let shared = TokenManager()
-    private let userDefaults = UserDefaults.standard
-    private let tokenKey = "auth_token"
-    private let tokenExpiryKey = "auth_token_expiry"
+    private let vault = TokenVault.shared
     
     private init() {}
     
     // MARK: - Token Management (equivalent to Android's TokenManager methods)
     
     /// Save token with proper error handling (equivalent to Android's saveToken)
+    /// Expiry comes from the token's own `exp` claim (falls back to 24 hours for opaque tokens)
     func saveToken(_ token: String) -> Result<Void, TokenError> {
-        userDefaults.set(token, forKey: tokenKey)
-        
-        // Set expiry time (24 hours from now, similar to Android)
-        let expiryTime = Date().timeIntervalSince1970 + (24 * 60 * 60)
-        userDefaults.set(expiryTime, forKey: tokenExpiryKey)
-        
-        print("✅ Token saved successfully")
-        return .success(())
+        let result = vault.save(token)
+        if case .success = result {
+            print("✅ Token saved successfully")
+        }
+        return result
     }
     
     /// Get current token (equivalent to Android's getToken)
     func getToken() -> Result<String?, TokenError> {
-        let token = userDefaults.string(forKey: tokenKey)
-        return .success(token)
+        return .success(vault.currentToken)
     }
     
     /// Clear token (equivalent to Android's clearToken)
     func clearToken() -> Result<Void, TokenError> {
-        userDefaults.removeObject(forKey: tokenKey)
-        userDefaults.removeObject(forKey: tokenExpiryKey)
-        print("✅ Token cleared successfully")
-        return .success(())
+        let result = vault.clear()
+        if case .success = result {
+            print("✅ Token cleared successfully")
+        }
+        return result
     }
     
     /// Check if token is valid (equivalent to Android's isTokenValid)
+    /// Memory-only read; called on every request so it does not log.
+    /// Expired tokens are kept so `TokenRefreshScheduler` can renew them instead of forcing a new sign-in.
     func isTokenValid() -> Bool {
-        guard let token = userDefaults.string(forKey: tokenKey), !token.isEmpty else {
-            print("❌ No token found in storage")
-            return false
-        }
-        
-        // Check expiry (optional, similar to Android logic)
-        let expiryTime = userDefaults.double(forKey: tokenExpiryKey)
-        if expiryTime > 0 && Date().timeIntervalSince1970 > expiryTime {
-            print("⚠️ Token expired at \(Date(timeIntervalSince1970: expiryTime))")
-            _ = clearToken() // Clear expired token
-            return false
-        }
-        
-        print("✅ Valid token found (expires: \(expiryTime > 0 ? Date(timeIntervalSince1970: expiryTime).description : "never"))")
-        return true
+        return vault.validToken != nil
+    }
+    
+    /// A token is stored but has passed its expiry
+    func hasExpiredToken() -> Bool {
+        return vault.currentToken != nil && vault.validToken == nil
     }
     
     /// Get token expiry date for debugging
     func getTokenExpiry() -> Date? {
-        let expiryTime = userDefaults.double(forKey: tokenExpiryKey)
-        return expiryTime > 0 ? Date(timeIntervalSince1970: expiryTime) : nil
+        return vault.expiryDate
     }
     
     /// Force clear tokens for testing (call manually when needed)
@@ -17,22 +17,11 @@ class LandingViewModel: ObservableObject {
     @Published var authStateText = "Initializing..."
     @Published var navigateToHome = false
     
-    private var authRepository: AuthRepository
+    private let authRepository: AuthRepository
     
     init() {
-        // Initialize KMP shared module - same as your Android app
-        SharedModuleInitializerKt.doInitKoin()
-        
-        // Create shared AuthRepository - same logic as Android!
-        let apiClient = ApiClient()
-        let googleSignInProvider = IOSGoogleSignInProvider()
-        let tokenStorage = IOSTokenStorage()
-        
-        self.authRepository = AuthRepository(
-            httpClient: apiClient.httpClient,
-            googleSignInProvider: googleSignInProvider,
-            tokenStorage: tokenStorage
-        )
+        // Shared AuthRepository - same logic as Android!
+        self.authRepository = AppContainer.shared.authRepository
         
         print("🚀 Shared Authentication Repository Initialized (same as Android!)")
         authStateText = "Ready - using shared Android logic"
@@ -0,0 +1,67 @@
+import Foundation
+import sharedKit
+
+// MARK: - App User
+/// The one user type the app passes around.
+/// sharedKit exports `User` (auth), `User_` and `User__` (the SQLDelight row); every property read on those
+/// crosses the ObjC bridge and converts an `NSString`. `AppUser` is bridged once, when it is built,
+/// so views reading `name` or `profilePicture` on every render stay in Swift.
+struct AppUser: Identifiable, Equatable {
+    let id: String
+    var name: String
+    var email: String
+    var displayName: String
+    var profilePicture: String?
+    var about: String?
+    var pronouns: String?
+    /// Set for users read back from `TalkeysDatabase`
+    var createdAt: String?
+
+    init(id: String, name: String, email: String, displayName: String? = nil, profilePicture: String? = nil, about: String? = nil, pronouns: String? = nil, createdAt: String? = nil) {
+        self.id = id
+        self.name = name
+        self.email = email
+        self.displayName = displayName ?? name
+        self.profilePicture = profilePicture
+        self.about = about
+        self.pronouns = pronouns
+        self.createdAt = createdAt
+    }
+
+    /// Convert the user carried by `AuthState.Success`; done once at the auth boundary
+    init(_ user: sharedKit.User) {
+        self.init(
+            id: user.id,
+            name: user.name,
+            email: user.email,
+            displayName: user.displayName,
+            profilePicture: user.profilePicture,
+            about: user.about,
+            pronouns: user.pronouns
+        )
+    }
+
+    var initials: String {
+        name.prefix(1).uppercased()
+    }
+}
+
+// MARK: - UserQueries Mapping
+extension UserQueries {
+    /// Row mapper for the generated `selectById` / `selectAll` queries, typed exactly as the header's
+    /// non-null `id (^)(NSString *, NSString *, NSString *, NSString * _Nullable, NSString *)`.
+    /// Builds `AppUser` straight from the cursor columns, so no `User__` is allocated per row.
+    /// The generated `User` table has no displayName, about or pronouns columns: those come back
+    /// as their defaults (`displayName` falls back to `name`).
+    static let appUserMapper: (String, String, String, String?, String) -> Any = { id, name, email, profilePicture, createdAt in
+        AppUser(id: id, name: name, email: email, profilePicture: profilePicture, createdAt: createdAt)
+    }
+
+    func selectAppUser(id: String) -> AppUser? {
+        selectById(id: id, mapper: UserQueries.appUserMapper).executeAsOneOrNull() as? AppUser
+    }
+
+    func selectAllAppUsers() -> [AppUser] {
+        selectAll(mapper: UserQueries.appUserMapper).executeAsList().compactMap { $0 as? AppUser }
+    }
+}
@@ -0,0 +1,56 @@
+import Foundation
+
+// MARK: - Event Decoding
+/// The single decoder for event payloads from the Talkeys API.
+/// Lists are decoded element by element, so one malformed event is dropped (and counted)
+/// instead of failing the whole page.
+enum EventDecoding {
+    struct Page {
+        let events: [EventResponse]
+        let pagination: Pagination?
+        /// Events present in the payload that could not be decoded
+        let skipped: Int
+    }
+
+    /// Reused across calls; decoding keeps no state on the decoder itself
+    private static let decoder = JSONDecoder()
+
+    static func decodeList(_ data: Data) throws -> Page {
+        let response = try decoder.decode(LossyEventListResponse.self, from: data)
+        let events = response.data.events.compactMap(\.event)
+        return Page(events: events, pagination: response.data.pagination, skipped: response.data.events.count - events.count)
+    }
+
+    /// `getEventById` has been seen both bare and wrapped in `{ "data": ... }`
+    static func decodeEvent(_ data: Data) throws -> EventResponse {
+        do {
+            return try decoder.decode(EventResponse.self, from: data)
+        } catch {
+            guard let wrapped = try? decoder.decode(Envelope.self, from: data) else { throw error }
+            return wrapped.data
+        }
+    }
+
+    // MARK: - Wire Types
+
+    private struct LossyEventListResponse: Decodable {
+        let data: LossyEventData
+    }
+
+    private struct LossyEventData: Decodable {
+        let events: [LossyEvent]
+        let pagination: Pagination?
+    }
+
+    private struct LossyEvent: Decodable {
+        let event: EventResponse?
+
+        init(from decoder: Decoder) throws {
+            event = try? EventResponse(from: decoder)
+        }
+    }
+
+    private struct Envelope: Decodable {
+        let data: EventResponse
+    }
+}
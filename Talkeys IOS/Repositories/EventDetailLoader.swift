@@ -0,0 +1,267 @@
+import Foundation
+
+// MARK: - Event Detail Loader
+/// Event details for the detail screen. The screen renders from the list snapshot at once;
+/// `getEventById` runs only when no fresh detail is cached, and its result is kept for `ttl` seconds.
+/// Cards call `preload(_:)` on press-down and when they reach the center, so by the time the tap
+/// lands the detail (and hero image) is usually already here.
+/// `details(for:)` looks up several ids at once for deep links, favorites and notifications.
+final class EventDetailLoader {
+    static let shared = EventDetailLoader()
+
+    /// One id's outcome from `details(for:)`
+    struct Lookup {
+        let eventId: String
+        let result: Result<EventResponse, Error>
+    }
+
+    /// Whether the server has a batch endpoint; learned from the first batch request
+    enum BatchSupport {
+        case unknown, supported, unsupported
+    }
+
+    /// Ids per batch request, keeping the query string well under URL length limits
+    static let maxBatchSize = 50
+
+    /// How long a fetched detail counts as fresh
+    let ttl: TimeInterval
+
+    private let fetch: (String) async throws -> EventResponse
+    private let fetchBatch: (([String]) async throws -> [EventResponse])?
+    private var batchSupportState = BatchSupport.unknown
+    private let images: ImageCache?
+    private let now: () -> Date
+    private let cache: CostCache<String, CachedDetail>
+    private let lock = NSLock()
+    private var inFlight: [String: InFlightFetch] = [:]
+
+    private struct CachedDetail {
+        let event: EventResponse
+        let fetchedAt: Date
+    }
+
+    /// One shared `getEventById` call and the callers still waiting on it; guarded by `lock`
+    private final class InFlightFetch {
+        let task: Task<EventResponse, Error>
+        var waiters = 0
+
+        init(task: Task<EventResponse, Error>) {
+            self.task = task
+        }
+    }
+
+    /// One caller's share of an `InFlightFetch`; it leaves once, whether it finishes or is cancelled
+    private final class Waiter {
+        var hasLeft = false
+    }
+
+    init(
+        ttl: TimeInterval = 300,
+        registry: CacheRegistry = .shared,
+        images: ImageCache? = .shared,
+        now: @escaping () -> Date = Date.init,
+        fetch: @escaping (String) async throws -> EventResponse = { try await EventAPIService.shared.getEventById($0) },
+        fetchBatch: (([String]) async throws -> [EventResponse])? = { try await EventAPIService.shared.getEventsByIds($0) }
+    ) {
+        self.ttl = ttl
+        self.images = images
+        self.now = now
+        self.fetch = fetch
+        self.fetchBatch = fetchBatch
+        self.cache = CostCache(name: "eventDetails", priority: .medium, limitBytes: 2 * 1024 * 1024, registry: registry) { _, detail in
+            detail.event.estimatedBytes
+        }
+    }
+
+    // MARK: - Public Methods
+
+    /// What to render right now: a fresh cached detail, else the list snapshot
+    func snapshot(for event: EventResponse) -> EventResponse {
+        cachedDetail(for: event._id) ?? event
+    }
+
+    /// Detail fetched within the TTL, if any
+    func cachedDetail(for eventId: String) -> EventResponse? {
+        guard let cached = cache.value(for: eventId) else { return nil }
+        guard now().timeIntervalSince(cached.fetchedAt) < ttl else {
+            cache.removeValue(for: eventId)
+            return nil
+        }
+        return cached.event
+    }
+
+    /// Fresh detail from cache, or fetched once however many callers ask concurrently.
+    /// A cancelled caller gives up its share of the fetch, and the fetch is cancelled once no caller is left.
+    func detail(for eventId: String, forceRefresh: Bool = false) async throws -> EventResponse {
+        if !forceRefresh, let cached = cachedDetail(for: eventId) {
+            return cached
+        }
+        try Task.checkCancellation()
+
+        lock.lock()
+        let shared: InFlightFetch
+        if let existing = inFlight[eventId] {
+            shared = existing
+        } else {
+            shared = InFlightFetch(task: Task.detached(priority: .userInitiated) { [fetch, weak self] () -> EventResponse in
+                let event = try await fetch(eventId)
+                self?.store(event)
+                return event
+            })
+            inFlight[eventId] = shared
+        }
+        shared.waiters += 1
+        lock.unlock()
+
+        let waiter = Waiter()
+        defer { leave(shared, eventId: eventId, waiter: waiter) }
+        return try await withTaskCancellationHandler {
+            try await shared.task.value
+        } onCancel: {
+            self.leave(shared, eventId: eventId, waiter: waiter)
+        }
+    }
+
+    /// Speculatively warm the detail and hero image; safe to call repeatedly
+    func preload(_ event: EventResponse) {
+        let eventId = event._id
+        guard !eventId.trimmingCharacters(in: .whitespacesAndNewlines).isEmpty else { return }
+
+        if cachedDetail(for: eventId) == nil {
+            Task.detached(priority: .utility) { [weak self] in
+                _ = try? await self?.detail(for: eventId)
+            }
+        }
+        if let images = images, let heroURL = event.photographs?.first.flatMap(URL.init(string:)), images.image(for: heroURL) == nil {
+            Task.detached(priority: .utility) {
+                _ = await images.load(heroURL)
+            }
+        }
+    }
+
+    /// Look up several events, yielding each as soon as it is known: cached details first, then one
+    /// request per `maxBatchSize` ids when the server supports batching, otherwise at most
+    /// `maxConcurrent` `getEventById` calls at a time. Duplicate ids are looked up once.
+    /// Cancelling the consuming task cancels the outstanding requests.
+    func details(for eventIds: [String], maxConcurrent: Int = 4) -> AsyncStream<Lookup> {
+        AsyncStream { continuation in
+            let task = Task.detached(priority: .userInitiated) { [weak self] in
+                await self?.lookUp(eventIds, maxConcurrent: maxConcurrent) { continuation.yield($0) }
+                continuation.finish()
+            }
+            continuation.onTermination = { _ in task.cancel() }
+        }
+    }
+
+    var batchSupport: BatchSupport {
+        lock.lock()
+        defer { lock.unlock() }
+        return batchSupportState
+    }
+
+    func invalidate(_ eventId: String) {
+        cache.removeValue(for: eventId)
+    }
+
+    func removeAll() {
+        cache.removeAll()
+    }
+
+    // MARK: - Private Helpers
+
+    private func leave(_ shared: InFlightFetch, eventId: String, waiter: Waiter) {
+        lock.lock()
+        defer { lock.unlock() }
+        guard !waiter.hasLeft else { return }
+        waiter.hasLeft = true
+
+        shared.waiters -= 1
+        guard shared.waiters == 0 else { return }
+        // No-op when the fetch already finished
+        shared.task.cancel()
+        if inFlight[eventId] === shared {
+            inFlight[eventId] = nil
+        }
+    }
+
+    private func store(_ event: EventResponse) {
+        cache.insert(CachedDetail(event: event, fetchedAt: now()), for: event._id)
+    }
+
+    private func lookUp(_ eventIds: [String], maxConcurrent: Int, emit: (Lookup) -> Void) async {
+        var seen = Set<String>()
+        var missing: [String] = []
+        for eventId in eventIds where !eventId.trimmingCharacters(in: .whitespacesAndNewlines).isEmpty && seen.insert(eventId).inserted {
+            if let cached = cachedDetail(for: eventId) {
+                emit(Lookup(eventId: eventId, result: .success(cached)))
+            } else {
+                missing.append(eventId)
+            }
+        }
+
+        if let fetchBatch = fetchBatch, missing.count > 1, batchSupport != .unsupported {
+            missing = await fetchInBatches(missing, using: fetchBatch, emit: emit)
+        }
+        await fanOut(missing, maxConcurrent: max(1, maxConcurrent), emit: emit)
+    }
+
+    /// Returns the ids the batch endpoint did not resolve, for the per-id fallback
+    private func fetchInBatches(_ eventIds: [String], using fetchBatch: ([String]) async throws -> [EventResponse], emit: (Lookup) -> Void) async -> [String] {
+        var unresolved: [String] = []
+        var start = 0
+        while start < eventIds.count, !Task.isCancelled {
+            let chunk = Array(eventIds[start..<min(start + EventDetailLoader.maxBatchSize, eventIds.count)])
+            start += chunk.count
+            do {
+                let events = try await fetchBatch(chunk)
+                setBatchSupport(.supported)
+                var returned = Set<String>()
+                for event in events where chunk.contains(event._id) && returned.insert(event._id).inserted {
+                    store(event)
+                    emit(Lookup(eventId: event._id, result: .success(event)))
+                }
+                // Missing from the batch response: let getEventById give the definitive answer
+                unresolved += chunk.filter { !returned.contains($0) }
+            } catch APIError.serverError(404) {
+                print("ℹ️ Batch event lookup not available, falling back to per-id requests")
+                setBatchSupport(.unsupported)
+                return unresolved + chunk + eventIds[start...]
+            } catch {
+                unresolved += chunk
+            }
+        }
+        return unresolved + eventIds[start...]
+    }
+
+    private func fanOut(_ eventIds: [String], maxConcurrent: Int, emit: (Lookup) -> Void) async {
+        guard !eventIds.isEmpty else { return }
+        await withTaskGroup(of: Lookup.self) { group in
+            var pending = eventIds.makeIterator()
+            for _ in 0..<maxConcurrent {
+                guard !Task.isCancelled, let eventId = pending.next() else { break }
+                group.addTask { await self.lookUpOne(eventId) }
+            }
+            for await lookup in group {
+                emit(lookup)
+                // Cancelled children finish with CancellationError; don't start more behind them
+                if !Task.isCancelled, let eventId = pending.next() {
+                    group.addTask { await self.lookUpOne(eventId) }
+                }
+            }
+        }
+    }
+
+    private func lookUpOne(_ eventId: String) async -> Lookup {
+        do {
+            return Lookup(eventId: eventId, result: .success(try await detail(for: eventId)))
+        } catch {
+            return Lookup(eventId: eventId, result: .failure(error))
+        }
+    }
+
+    private func setBatchSupport(_ support: BatchSupport) {
+        lock.lock()
+        batchSupportState = support
+        lock.unlock()
+    }
+}
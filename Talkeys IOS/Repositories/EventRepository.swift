@@ -23,36 +23,25 @@ struct Pagination: Codable {
 class EventAPIService {
     static let shared = EventAPIService()
     private let baseURL = "https://api.talkeys.xyz/"
+    private let client: HTTPClient
     
-    private init() {}
+    private init(client: HTTPClient = .shared) {
+        self.client = client
+    }
     
     func getAllEvents() async throws -> [EventResponse] {
         guard let url = URL(string: "\(baseURL)getEvents") else {
             throw APIError.invalidURL
         }
         
-        var request = URLRequest(url: url)
-        request.httpMethod = "GET"
-        request.setValue("application/json", forHTTPHeaderField: "Content-Type")
-        
-        // Add authorization header if needed
-        if let token = UserDefaults.standard.string(forKey: "auth_token") {
-            request.setValue("Bearer \(token)", forHTTPHeaderField: "Authorization")
-        }
-        
-        let (data, response) = try await URLSession.shared.data(for: request)
-        
-        guard let httpResponse = response as? HTTPURLResponse else {
-            throw APIError.invalidResponse
-        }
-        
-        guard 200...299 ~= httpResponse.statusCode else {
-            throw APIError.serverError(httpResponse.statusCode)
-        }
+        let data = try await sendAuthorized(URLRequest(url: url), endpoint: .list)
         
         do {
-            let eventListResponse = try JSONDecoder().decode(EventListResponse.self, from: data)
-            return eventListResponse.data.events
+            let page = try EventDecoding.decodeList(data)
+            if page.skipped > 0 {
+                print("⚠️ Skipped \(page.skipped) malformed events")
+            }
+            return page.events
         } catch {
             print("JSON Decoding Error: \(error)")
             throw APIError.decodingError(error)
@@ -64,35 +53,66 @@ class EventAPIService {
             throw APIError.invalidURL
         }
         
-        var request = URLRequest(url: url)
-        request.httpMethod = "GET"
-        request.setValue("application/json", forHTTPHeaderField: "Content-Type")
+        let data = try await sendAuthorized(URLRequest(url: url), endpoint: .detail)
         
-        // Add authorization header if needed
-        if let token = UserDefaults.standard.string(forKey: "auth_token") {
-            request.setValue("Bearer \(token)", forHTTPHeaderField: "Authorization")
+        do {
+            return try EventDecoding.decodeEvent(data)
+        } catch {
+            print("JSON Decoding Error: \(error)")
+            throw APIError.decodingError(error)
         }
-        
-        let (data, response) = try await URLSession.shared.data(for: request)
-        
-        guard let httpResponse = response as? HTTPURLResponse else {
-            throw APIError.invalidResponse
+    }
+    
+    /// Several events in one request. Assumes the list response shape; callers fall back to
+    /// `getEventById` when the server answers 404 (no batch endpoint deployed).
+    func getEventsByIds(_ eventIds: [String]) async throws -> [EventResponse] {
+        var components = URLComponents(string: "\(baseURL)getEventsByIds")
+        components?.queryItems = [URLQueryItem(name: "ids", value: eventIds.joined(separator: ","))]
+        guard let url = components?.url else {
+            throw APIError.invalidURL
         }
         
-        guard 200...299 ~= httpResponse.statusCode else {
-            throw APIError.serverError(httpResponse.statusCode)
-        }
+        let data = try await sendAuthorized(URLRequest(url: url), endpoint: .list)
         
-        // For single event response, it might have a different structure
-        // Adjust based on your API response structure
         do {
-            let eventResponse = try JSONDecoder().decode(EventResponse.self, from: data)
-            return eventResponse
+            return try EventDecoding.decodeList(data).events
         } catch {
             print("JSON Decoding Error: \(error)")
             throw APIError.decodingError(error)
         }
     }
+    
+    // MARK: - Private Helpers
+    
+    /// Send a GET request with the current token; a 401 waits for the shared token refresh and retries once
+    private func sendAuthorized(_ baseRequest: URLRequest, endpoint: EndpointClass) async throws -> Data {
+        try await TokenRefreshScheduler.shared.performAuthorized { token in
+            var request = baseRequest
+            request.httpMethod = "GET"
+            request.setValue("application/json", forHTTPHeaderField: "Content-Type")
+            
+            // Add authorization header if needed (in-memory read)
+            if let token = token {
+                request.setValue("Bearer \(token)", forHTTPHeaderField: "Authorization")
+            }
+            
+            let (data, response) = try await client.data(for: request, endpoint: endpoint)
+            
+            guard let httpResponse = response as? HTTPURLResponse else {
+                throw APIError.invalidResponse
+            }
+            
+            if httpResponse.statusCode == 401 {
+                throw APIError.unauthorized
+            }
+            
+            guard 200...299 ~= httpResponse.statusCode else {
+                throw APIError.serverError(httpResponse.statusCode)
+            }
+            
+            return data
+        }
+    }
 }
 
 // MARK: - Event Repository
@@ -104,11 +124,44 @@ class EventRepository: ObservableObject {
     @Published var isLoading = false
     @Published var errorMessage: String?
     
-    private let cache = NSCache<NSString, NSArray>()
+    /// Last fetched list; what's on screen, so it is the last cache shed under memory pressure
+    private let cache = CostCache<String, [EventResponse]>(name: "events", priority: .high, limitBytes: 8 * 1024 * 1024) { _, events in
+        events.reduce(0) { $0 + $1.estimatedBytes }
+    }
+    /// Ranked FTS pages keyed by query, page and page size; dropped whenever the event table changes
+    private let searchCache = CostCache<String, [EventResponse]>(name: "searchResults", priority: .low, limitBytes: 1024 * 1024) { key, events in
+        key.utf8.count + events.reduce(0) { $0 + $1.estimatedBytes }
+    }
     private let cacheExpiryTime: TimeInterval = 300 // 5 minutes
-    private var lastFetchTime: Date?
+    private let defaults = UserDefaults.standard
+    private let lastFetchTimeKey = "events_last_fetched_at"
+    
+    /// Persisted so a list fetched by background refresh counts as fresh on the next launch
+    private var lastFetchTime: Date? {
+        get { defaults.object(forKey: lastFetchTimeKey) as? Date }
+        set { defaults.set(newValue, forKey: lastFetchTimeKey) }
+    }
+    
+    /// On-device event tables; the source for filters and offline launches
+    private var store: EventQueries {
+        AppContainer.shared.eventQueries
+    }
     
-    private init() {}
+    private var storeObservation: Task<Void, Never>?
+    private var searchIndexObservation: AnyCancellable?
+    
+    /// What `searchEvents` checks on every keystroke, kept up to date by the store observation
+    /// and migration progress instead of being queried each time
+    private struct SearchReadiness {
+        var indexReady = false
+        var hasStoredEvents = false
+    }
+    private var searchReadiness = SearchReadiness()
+    private let searchReadinessLock = NSLock()
+    
+    private init() {
+        observeStore()
+    }
     
     // MARK: - Public Methods
     
@@ -132,11 +185,13 @@ class EventRepository: ObservableObject {
         do {
             let fetchedEvents = try await apiService.getAllEvents()
             
+            // `events` also follows the local table, but that update lands a hop later;
+            // publish now so callers can regroup as soon as this returns
+            storeFetchedEvents(fetchedEvents)
+            
             await MainActor.run {
                 self.events = fetchedEvents
                 self.isLoading = false
-                self.cacheEvents(fetchedEvents)
-                self.lastFetchTime = Date()
             }
             
             print("Successfully fetched \(fetchedEvents.count) events")
@@ -158,37 +213,57 @@ class EventRepository: ObservableObject {
     }
     
     /// Fetch event by ID
-    /// - Parameter eventId: The ID of the event to fetch
-    /// - Returns: EventResponse object
-    func fetchEventById(_ eventId: String) async throws -> EventResponse {
-        return try await apiService.getEventById(eventId)
+    /// - Parameters:
+    ///   - eventId: The ID of the event to fetch
+    ///   - forceRefresh: If true, bypasses the detail cache
+    /// - Returns: EventResponse object, served from `EventDetailLoader`'s cache while fresh
+    func fetchEventById(_ eventId: String, forceRefresh: Bool = false) async throws -> EventResponse {
+        return try await EventDetailLoader.shared.detail(for: eventId, forceRefresh: forceRefresh)
     }
     
-    /// Get live events only
+    /// Get live events only (indexed query on the local event table)
     func getLiveEvents() -> [EventResponse] {
-        return events.filter { $0.isLive == true }
+        return store.selectLive()
     }
     
-    /// Get past events only  
+    /// Get past events only (indexed query on the local event table)
     func getPastEvents() -> [EventResponse] {
-        return events.filter { $0.isLive != true }
+        return store.selectPast()
     }
     
     /// Get events by category
-    /// - Parameter category: The category to filter by
+    /// - Parameter category: The category to filter by (case-insensitive)
     /// - Returns: Array of events in the specified category
     func getEventsByCategory(_ category: String) -> [EventResponse] {
-        return events.filter { 
-            $0.category.lowercased() == category.lowercased() 
-        }
+        return store.selectByCategory(category)
     }
     
-    /// Search events by text
-    /// - Parameter searchText: The text to search for
-    /// - Returns: Array of events matching the search criteria
-    func searchEvents(_ searchText: String) -> [EventResponse] {
+    /// Search events by text using the FTS5 index on the local event table
+    /// - Parameters:
+    ///   - searchText: The text to search for (each word is prefix-matched)
+    ///   - page: Zero-based page index
+    ///   - pageSize: Number of ranked results per page
+    /// - Returns: Array of events matching the search criteria, best match first
+    func searchEvents(_ searchText: String, page: Int = 0, pageSize: Int = 50) -> [EventResponse] {
         guard !searchText.isEmpty else { return events }
         
+        // Nothing persisted yet, or the search index is still backfilling: scan what's in memory
+        let readiness = currentSearchReadiness
+        guard readiness.indexReady, readiness.hasStoredEvents else {
+            return EventRepository.scan(events, for: searchText)
+        }
+        
+        let key = "\(searchText.lowercased())|\(page)|\(pageSize)"
+        if let cached = searchCache.value(for: key) {
+            return cached
+        }
+        let results = store.search(searchText, limit: pageSize, offset: page * pageSize)
+        searchCache.insert(results, for: key)
+        return results
+    }
+    
+    /// Linear substring scan over in-memory events
+    static func scan(_ events: [EventResponse], for searchText: String) -> [EventResponse] {
         return events.filter { event in
             event.name.lowercased().contains(searchText.lowercased()) ||
             (event.location?.lowercased().contains(searchText.lowercased()) == true) ||
@@ -207,30 +282,86 @@ class EventRepository: ObservableObject {
         }.filter { !$0.value.isEmpty }
     }
     
+    // MARK: - Local Store Observation
+    
+    /// Publish the persisted events on launch and after every write to the event table
+    private func observeStore() {
+        storeObservation = Task { [weak self] in
+            // Resolve the store off main: the repository is created on the first frame,
+            // before the deferred "LocalDatabaseOpen" stage has opened the database
+            guard let changes = self?.store.changes({ $0.selectAll() }) else { return }
+            self?.observeSearchIndex()
+            for await storedEvents in changes {
+                self?.searchCache.removeAll()
+                self?.updateSearchReadiness { $0.hasStoredEvents = !storedEvents.isEmpty }
+                await MainActor.run {
+                    self?.events = storedEvents
+                }
+            }
+        }
+    }
+    
+    /// The backfill only ever goes from incomplete to complete: read it once, then follow its progress.
+    /// Subscribes before reading so a completion in between isn't missed.
+    private func observeSearchIndex() {
+        let migrations = AppContainer.shared.databaseProvider.migrations
+        let migrationId = EventQueries.SearchIndexBackfill.migrationId
+        searchIndexObservation = migrations.progress
+            .filter { $0.id == migrationId && $0.isComplete }
+            .sink { [weak self] _ in
+                self?.updateSearchReadiness { $0.indexReady = true }
+            }
+        if migrations.isComplete(migrationId) {
+            updateSearchReadiness { $0.indexReady = true }
+        }
+    }
+    
+    private var currentSearchReadiness: SearchReadiness {
+        searchReadinessLock.lock()
+        defer { searchReadinessLock.unlock() }
+        return searchReadiness
+    }
+    
+    private func updateSearchReadiness(_ change: (inout SearchReadiness) -> Void) {
+        searchReadinessLock.lock()
+        change(&searchReadiness)
+        searchReadinessLock.unlock()
+    }
+    
     // MARK: - Cache Management
     
-    private func cacheEvents(_ events: [EventResponse]) {
-        cache.setObject(events as NSArray, forKey: "all_events")
+    /// Persist a freshly fetched list and mark it fresh; shared by foreground fetches and background refresh
+    func storeFetchedEvents(_ events: [EventResponse]) {
+        store.replaceAll(with: events)
+        cache.insert(events, for: "all_events")
+        lastFetchTime = Date()
     }
     
     private func getCachedEvents() -> [EventResponse]? {
         // Check if cache is expired
         if let lastFetch = lastFetchTime,
            Date().timeIntervalSince(lastFetch) > cacheExpiryTime {
-            cache.removeObject(forKey: "all_events")
+            cache.removeValue(for: "all_events")
             return nil
         }
         
-        guard let cachedArray = cache.object(forKey: "all_events") as? [EventResponse] else {
-            return nil
+        if let cached = cache.value(for: "all_events") {
+            return cached
         }
         
-        return cachedArray
+        // Fresh rows persisted by background refresh (or an earlier session) need no network wait
+        guard lastFetchTime != nil else { return nil }
+        let stored = store.selectAll()
+        guard !stored.isEmpty else { return nil }
+        cache.insert(stored, for: "all_events")
+        return stored
     }
     
     /// Clear all cached data
     func clearCache() {
-        cache.removeAllObjects()
+        cache.removeAll()
+        searchCache.removeAll()
+        EventDetailLoader.shared.removeAll()
         lastFetchTime = nil
     }
     
@@ -240,6 +371,17 @@ class EventRepository: ObservableObject {
     }
 }
 
+// MARK: - Cache Cost
+extension EventResponse {
+    /// Approximate resident size: the struct plus the UTF-8 storage of its strings
+    var estimatedBytes: Int {
+        let strings = [name, category, mode, location, duration, visibility, startDate, startTime,
+                       endRegistrationDate, eventDescription, prizes, organizerName, organizerEmail,
+                       organizerContact, _id].compactMap { $0 } + (photographs ?? [])
+        return MemoryLayout<EventResponse>.stride + strings.reduce(0) { $0 + $1.utf8.count }
+    }
+}
+
 // MARK: - API Error Handling
 enum APIError: Error, LocalizedError {
     case invalidURL
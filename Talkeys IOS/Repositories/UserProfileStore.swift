@@ -0,0 +1,38 @@
+import Foundation
+import sharedKit
+
+// MARK: - User Profile Store
+/// Keeps the last signed-in `AppUser` in `TalkeysDatabase` so launch can show it before the backend answers
+final class UserProfileStore {
+    private let queries: UserQueries
+    private let defaults: UserDefaults
+    private let lastUserIdKey = "last_signed_in_user_id"
+
+    init(queries: UserQueries, defaults: UserDefaults = .standard) {
+        self.queries = queries
+        self.defaults = defaults
+    }
+
+    /// Last known user, read synchronously from the local database.
+    /// Only id, name, email, profilePicture and createdAt round-trip: the sharedKit `User` table
+    /// has no columns for displayName, about or pronouns, and its schema is owned by the KMP module.
+    /// A restored user therefore shows `name` as its display name, with no about or pronouns,
+    /// until session validation replaces it with the backend's full profile.
+    func cachedUser() -> AppUser? {
+        guard let userId = defaults.string(forKey: lastUserIdKey) else { return nil }
+        return queries.selectAppUser(id: userId)
+    }
+
+    /// Drops displayName, about and pronouns (see `cachedUser()`)
+    func save(_ user: AppUser) {
+        queries.upsert([user])
+        defaults.set(user.id, forKey: lastUserIdKey)
+    }
+
+    func clear() {
+        if let userId = defaults.string(forKey: lastUserIdKey) {
+            queries.deleteUser(id: userId)
+        }
+        defaults.removeObject(forKey: lastUserIdKey)
+    }
+}
@@ -11,22 +11,47 @@ import sharedKit
 
 @main
 struct Talkeys_IOSApp: App {
+    init() {
+        // Only critical stages run before the first frame; the rest waits for MainAppView to appear
+        StartupOrchestrator.shared.registerAppStages()
+        StartupOrchestrator.shared.runCriticalPath()
+    }
+    
     var body: some Scene {
         WindowGroup {
             MainAppView()
                 .onAppear {
-                    configureGoogleSignIn()
+                    StartupOrchestrator.shared.runDeferredStages()
                 }
                 .onOpenURL { url in
                     GIDSignIn.sharedInstance.handle(url)
                 }
+                .onReceive(NotificationCenter.default.publisher(for: UIApplication.didEnterBackgroundNotification)) { _ in
+                    // Pause migrations at the next chunk boundary; they resume from the saved cursor
+                    // when the app returns to the foreground
+                    AppContainer.shared.databaseProvider.migrations.cancel()
+                    // Pre-warm the event list for the next launch while a session exists
+                    if TokenManager.shared.isTokenValid() {
+                        BackgroundRefresh.schedule()
+                    }
+                    // Debug builds dump per-statement DB metrics each time the app is backgrounded
+                    AppContainer.shared.databaseProvider.instrumentation?.printReport()
+                    #if DEBUG
+                    HTTPMetrics.shared.printReport()
+                    print(AuthFlowMetrics.shared.report())
+                    print(AppContainer.shared.timingReport())
+                    print(CacheRegistry.shared.report())
+                    #endif
+                }
+                .onReceive(NotificationCenter.default.publisher(for: UIApplication.willEnterForegroundNotification)) { _ in
+                    // Pick up migrations paused in the background; a no-op if already complete or running
+                    AppContainer.shared.databaseProvider.migrations.runInBackground()
+                }
         }
     }
     
-    private func configureGoogleSignIn() {
+    static func configureGoogleSignIn() {
         print("🔧 Configuring Google Sign-In...")
-        print("📁 Bundle ID: \(Bundle.main.bundleIdentifier ?? "Unknown")")
-        print("📁 Bundle path: \(Bundle.main.bundleURL.path)")
         
         guard let path = Bundle.main.path(forResource: "GoogleService-Info", ofType: "plist") else {
             print("❌ Error: GoogleService-Info.plist not found in bundle")
@@ -34,46 +59,104 @@ struct Talkeys_IOSApp: App {
             return
         }
         
-        print("✅ Found GoogleService-Info.plist at: \(path)")
-        
         guard let plist = NSDictionary(contentsOfFile: path) else {
             print("❌ Error: Could not read GoogleService-Info.plist")
             return
         }
         
-        print("📄 Plist contents: \(plist)")
-        
         guard let clientId = plist["CLIENT_ID"] as? String else {
             print("❌ Error: CLIENT_ID missing from GoogleService-Info.plist")
             return
         }
         
-        print("🆔 Client ID found: \(clientId)")
-        
         // Configure Google Sign-In
         let configuration = GIDConfiguration(clientID: clientId)
         GIDSignIn.sharedInstance.configuration = configuration
         
         print("✅ Google Sign-In configured successfully!")
-        print("🔍 Current configuration: \(GIDSignIn.sharedInstance.configuration?.clientID ?? "NOT SET")")
+    }
+}
+
+// MARK: - Startup Stages
+extension StartupOrchestrator {
+    /// Register the app's launch work. Nothing here should block the first frame unless it is critical.
+    /// - Parameter container: where the database and KMP graph are built (tests pass a fresh one)
+    func registerAppStages(container: AppContainer = .shared) {
+        // Critical: MainAppView picks its first screen from the stored token, so this
+        // Keychain read happens before the first frame either way
+        register("TokenPreload", priority: .critical) {
+            _ = TokenManager.shared.getToken()
+        }
+        
+        // Critical: BGTaskScheduler handlers must be registered before launch finishes
+        register("BackgroundRefreshRegistration", priority: .critical) {
+            BackgroundRefresh.register()
+        }
+        
+        // Deferred, and first: open SQLite (schema, pragmas, WAL) off main. The cached user
+        // is read on the auth IO queue and lands a moment after the first frame.
+        register("LocalDatabaseOpen", priority: .deferred) {
+            container.prewarm([.databaseProvider, .userProfileStore])
+        }
+        
+        // Deferred: GIDSignIn is only needed once the user taps "Login with Google"
+        register("GoogleSignInConfiguration", priority: .deferred, runsOnMain: true) {
+            Talkeys_IOSApp.configureGoogleSignIn()
+        }
+        
+        // Deferred: Koin graph for the shared KMP module
+        register("KoinInitialization", priority: .deferred) {
+            _ = container.koin
+        }
+        
+        // Deferred: build the single ApiClient/AuthRepository graph off the main thread;
+        // the leaf definitions build concurrently and AuthRepository picks them up
+        register("AuthRepositoryWarmup", priority: .deferred) {
+            container.prewarm([.apiClient, .tokenStorage, .googleSignInProvider, .authRepository])
+        }
         
-        // Test if we can get current user
-        if let currentUser = GIDSignIn.sharedInstance.currentUser {
-            print("👤 Current user already signed in: \(currentUser.profile?.name ?? "Unknown")")
-        } else {
-            print("👤 No current user signed in")
+        // Deferred: keep the token renewed ahead of its expiry (needs GIDSignIn configured first)
+        register("TokenRefreshScheduler", priority: .deferred) {
+            TokenRefreshScheduler.shared.start()
+        }
+        
+        // Deferred: chunked data migrations (e.g. search index backfill) on their own utility queue
+        register("DatabaseMigrations", priority: .deferred) {
+            container.databaseProvider.migrations.runInBackground()
+        }
+        
+        // Deferred: shed in-memory caches by priority on memory warnings
+        register("MemoryPressureMonitor", priority: .deferred) {
+            CacheRegistry.shared.startMonitoring()
+        }
+        
+        // Deferred: custom font registration check (debug aid only)
+        register("FontAvailabilityCheck", priority: .deferred) {
+            if !Font.isUrbanistAvailable() {
+                print("⚠️ Urbanist-Regular font not available, falling back to system font")
+            }
         }
     }
 }
 
 struct MainAppView: View {
-    @State private var isLoggedIn = false
-    @State private var isCheckingAuth = true
+    /// Owned by `AppContainer`, so views observe it rather than own it
+    @ObservedObject private var authViewModel = AppContainer.shared.authViewModel
+    @State private var isLoggedIn: Bool
+    @State private var isCheckingAuth: Bool
+    
+    init() {
+        // The token is already in memory (critical startup stage), so a returning user
+        // goes straight to the events screen on the first frame instead of the splash
+        let hasValidToken = TokenManager.shared.isTokenValid()
+        _isLoggedIn = State(initialValue: hasValidToken)
+        _isCheckingAuth = State(initialValue: !hasValidToken && TokenManager.shared.hasExpiredToken())
+    }
     
     var body: some View {
         Group {
             if isCheckingAuth {
-                // Show loading screen while checking authentication
+                // Show loading screen while an expired token is being refreshed
                 SplashLoadingView()
             } else if isLoggedIn {
                 // Navigate to ExploreEventsView after successful authentication
@@ -87,43 +170,52 @@ struct MainAppView: View {
         .onAppear {
             checkExistingAuthentication()
         }
+        .onChange(of: authViewModel.isLoggedIn) { newValue in
+            // Background validation (or sign-out) can end the session after the first frame
+            if !newValue && isLoggedIn {
+                isLoggedIn = false
+            }
+        }
     }
     
     private func checkExistingAuthentication() {
         print("🔍 Checking existing authentication...")
         
-        // Simple timeout-based check to prevent infinite loading
+        if isLoggedIn {
+            // Cached user renders now; backend validation runs concurrently
+            authViewModel.checkExistingAuth()
+            return
+        }
+        
+        guard isCheckingAuth else {
+            print("❌ No valid token found, showing login screen")
+            return
+        }
+        
+        // Only an expired token gets here: try a silent refresh, bounded to 3 seconds
         Task {
-            // Add a maximum timeout of 3 seconds
             let timeoutTask = Task {
                 try? await Task.sleep(nanoseconds: 3_000_000_000) // 3 seconds
                 await MainActor.run {
                     if isCheckingAuth {
-                        print("⏰ Authentication check timed out, showing login screen")
+                        print("⏰ Token refresh timed out, showing login screen")
                         isLoggedIn = false
                         isCheckingAuth = false
                     }
                 }
             }
             
-            // Check if we have a valid token stored locally
-            if TokenManager.shared.isTokenValid() {
-                print("✅ Valid token found, attempting quick validation...")
+            let refreshed = (try? await TokenRefreshScheduler.shared.refreshNow()) != nil
+            
+            await MainActor.run {
+                timeoutTask.cancel()
+                guard isCheckingAuth else { return }
                 
-                // Simple validation - if token exists and is valid, assume user is logged in
-                // This avoids the complex backend check that was causing issues
-                await MainActor.run {
-                    print("✅ Auto-login successful (token-based)")
-                    isLoggedIn = true
-                    isCheckingAuth = false
-                    timeoutTask.cancel()
-                }
-            } else {
-                print("❌ No valid token found, showing login screen")
-                await MainActor.run {
-                    isLoggedIn = false
-                    isCheckingAuth = false
-                    timeoutTask.cancel()
+                print(refreshed ? "✅ Expired token refreshed silently" : "❌ Token refresh failed, showing login screen")
+                isLoggedIn = refreshed
+                isCheckingAuth = false
+                if refreshed {
+                    authViewModel.checkExistingAuth()
                 }
             }
         }
@@ -0,0 +1,212 @@
+import Foundation
+import sharedKit
+
+// MARK: - App Container
+/// Process-wide dependency container for the shared KMP graph.
+/// Every screen resolves its `AuthRepository` (and therefore its Ktor `HttpClient`) from here,
+/// so there is exactly one HTTP client and connection pool per process.
+///
+/// Definitions are lazy and built at most once. Each has its own lock, so a heavy definition
+/// being pre-warmed in the background never blocks the main thread resolving an unrelated one.
+final class AppContainer {
+    static let shared = AppContainer()
+
+    /// Definitions that can be pre-warmed off the main thread
+    enum Definition: String, CaseIterable {
+        case koin = "KoinModules"
+        case apiClient = "ApiClient"
+        case tokenStorage = "IOSTokenStorage"
+        case googleSignInProvider = "IOSGoogleSignInProvider"
+        case authRepository = "AuthRepository"
+        case databaseProvider = "DatabaseProvider"
+        case userProfileStore = "UserProfileStore"
+    }
+
+    /// Construction time for one definition; `selfTime` excludes the dependencies it built
+    struct DefinitionTiming {
+        let key: String
+        let totalTime: TimeInterval
+        let selfTime: TimeInterval
+        let onMainThread: Bool
+    }
+
+    private let lock = NSLock()
+    private var instances: [String: AnyObject] = [:]
+    private var creationCounts: [String: Int] = [:]
+    private var definitionLocks: [String: NSRecursiveLock] = [:]
+    private var timings: [String: DefinitionTiming] = [:]
+    private let prewarmQueue = DispatchQueue(label: "AppContainer.prewarm", qos: .utility, attributes: .concurrent)
+
+    init() {}
+
+    // MARK: - Shared KMP Dependencies
+
+    /// sharedModule/platformModule must be loaded before any shared type is built
+    var koin: KoinInitializer {
+        singleton(Definition.koin.rawValue) {
+            KoinInitializer.shared.initializeKoin()
+            return KoinInitializer.shared
+        }
+    }
+
+    var apiClient: ApiClient {
+        singleton("ApiClient") {
+            _ = koin
+            return ApiClient()
+        }
+    }
+
+    var tokenStorage: IOSTokenStorage {
+        singleton("IOSTokenStorage") { IOSTokenStorage() }
+    }
+
+    var googleSignInProvider: IOSGoogleSignInProvider {
+        singleton("IOSGoogleSignInProvider") { IOSGoogleSignInProvider() }
+    }
+
+    var authRepository: AuthRepository {
+        singleton("AuthRepository") {
+            AuthRepository(
+                httpClient: apiClient.httpClient,
+                googleSignInProvider: googleSignInProvider,
+                tokenStorage: tokenStorage
+            )
+        }
+    }
+
+    // MARK: - Local Database
+
+    var databaseProvider: DatabaseProvider {
+        singleton("DatabaseProvider") { DatabaseProvider() }
+    }
+
+    var userProfileStore: UserProfileStore {
+        singleton("UserProfileStore") { UserProfileStore(queries: databaseProvider.userQueries) }
+    }
+
+    var eventQueries: EventQueries {
+        databaseProvider.eventQueries
+    }
+
+    // MARK: - View Models
+
+    /// Single auth state shared by the landing page, top bar and events screen
+    @MainActor
+    var authViewModel: AuthViewModel {
+        singleton("AuthViewModel") { AuthViewModel(container: self) }
+    }
+
+    // MARK: - Pre-warming
+
+    /// Build the given definitions concurrently on a utility queue; already-built ones are skipped
+    func prewarm(_ definitions: [Definition], completion: (() -> Void)? = nil) {
+        let group = DispatchGroup()
+        for definition in definitions {
+            prewarmQueue.async(group: group) { [self] in
+                resolve(definition)
+            }
+        }
+        group.notify(queue: prewarmQueue) {
+            completion?()
+        }
+    }
+
+    private func resolve(_ definition: Definition) {
+        switch definition {
+        case .koin: _ = koin
+        case .apiClient: _ = apiClient
+        case .tokenStorage: _ = tokenStorage
+        case .googleSignInProvider: _ = googleSignInProvider
+        case .authRepository: _ = authRepository
+        case .databaseProvider: _ = databaseProvider
+        case .userProfileStore: _ = userProfileStore
+        }
+    }
+
+    // MARK: - Diagnostics
+
+    /// Number of times each dependency has been constructed (should never exceed 1)
+    func instanceCount(of key: String) -> Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return creationCounts[key, default: 0]
+    }
+
+    func timing(of key: String) -> DefinitionTiming? {
+        lock.lock()
+        defer { lock.unlock() }
+        return timings[key]
+    }
+
+    func timingReport() -> String {
+        lock.lock()
+        let sorted = timings.values.sorted { $0.selfTime > $1.selfTime }
+        lock.unlock()
+
+        var lines = ["🧩 Dependency construction times:"]
+        for timing in sorted {
+            lines.append("   \(timing.key) — \(String(format: "%.1f", timing.selfTime * 1000))ms self, \(String(format: "%.1f", timing.totalTime * 1000))ms total\(timing.onMainThread ? " ⚠️ main thread" : "")")
+        }
+        return lines.joined(separator: "\n")
+    }
+
+    // MARK: - Private Helpers
+
+    /// Time spent in nested definitions, per thread, so a parent's self time can exclude it
+    private static let nestedTimeKey = "AppContainer.nestedTime"
+
+    private func singleton<T: AnyObject>(_ key: String, make: () -> T) -> T {
+        if let existing = instance(for: key) as? T {
+            return existing
+        }
+
+        let definitionLock = self.definitionLock(for: key)
+        definitionLock.lock()
+        defer { definitionLock.unlock() }
+
+        // Another thread may have finished building it while we waited
+        if let existing = instance(for: key) as? T {
+            return existing
+        }
+
+        let threadStorage = Thread.current.threadDictionary
+        let outerNestedTime = threadStorage[AppContainer.nestedTimeKey] as? TimeInterval ?? 0
+        threadStorage[AppContainer.nestedTimeKey] = 0.0
+
+        let start = CFAbsoluteTimeGetCurrent()
+        let instance = make()
+        let totalTime = CFAbsoluteTimeGetCurrent() - start
+
+        let nestedTime = threadStorage[AppContainer.nestedTimeKey] as? TimeInterval ?? 0
+        threadStorage[AppContainer.nestedTimeKey] = outerNestedTime + totalTime
+
+        let timing = DefinitionTiming(key: key, totalTime: totalTime, selfTime: max(0, totalTime - nestedTime), onMainThread: Thread.isMainThread)
+        lock.lock()
+        instances[key] = instance
+        creationCounts[key, default: 0] += 1
+        timings[key] = timing
+        lock.unlock()
+
+        #if DEBUG
+        print("🧩 Created \(key) in \(String(format: "%.1f", totalTime * 1000))ms (self \(String(format: "%.1f", timing.selfTime * 1000))ms)\(timing.onMainThread ? " on main thread" : "")")
+        #endif
+        return instance
+    }
+
+    private func instance(for key: String) -> AnyObject? {
+        lock.lock()
+        defer { lock.unlock() }
+        return instances[key]
+    }
+
+    private func definitionLock(for key: String) -> NSRecursiveLock {
+        lock.lock()
+        defer { lock.unlock() }
+        if let existing = definitionLocks[key] {
+            return existing
+        }
+        let created = NSRecursiveLock()
+        definitionLocks[key] = created
+        return created
+    }
+}
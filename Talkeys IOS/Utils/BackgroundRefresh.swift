@@ -0,0 +1,145 @@
+import Foundation
+import BackgroundTasks
+import UIKit
+
+// MARK: - Event Prewarmer
+/// Fetches, decodes and persists the first page of events, then pre-decodes the top images,
+/// so the next foreground launch opens on fresh data. Stops at `deadline` or on cancellation,
+/// keeping whatever finished.
+final class EventPrewarmer {
+    struct Report {
+        let fetched: Int
+        let imagesDecoded: Int
+        let duration: TimeInterval
+        /// False when cancellation or the deadline cut the run short
+        let completed: Bool
+    }
+
+    private let fetchEvents: () async throws -> [EventResponse]
+    private let persist: ([EventResponse]) -> Void
+    private let loadImage: (URL) async -> UIImage?
+    private let imageCount: Int
+    private let deadline: TimeInterval
+    private let now: () -> TimeInterval
+
+    /// - Parameters:
+    ///   - imageCount: Hero images of the first events to decode
+    ///   - deadline: Seconds to spend in total; BGAppRefreshTask grants roughly 30
+    ///   - now: Clock the deadline is measured on; tests advance their own
+    init(
+        imageCount: Int = 8,
+        deadline: TimeInterval = 25,
+        now: @escaping () -> TimeInterval = CFAbsoluteTimeGetCurrent,
+        fetchEvents: @escaping () async throws -> [EventResponse],
+        persist: @escaping ([EventResponse]) -> Void,
+        loadImage: @escaping (URL) async -> UIImage?
+    ) {
+        self.imageCount = imageCount
+        self.deadline = deadline
+        self.now = now
+        self.fetchEvents = fetchEvents
+        self.persist = persist
+        self.loadImage = loadImage
+    }
+
+    /// Live dependencies: the events API, the local event table and `ImageCache`
+    static func live() -> EventPrewarmer {
+        EventPrewarmer(
+            fetchEvents: { try await EventAPIService.shared.getAllEvents() },
+            persist: { EventRepository.shared.storeFetchedEvents($0) },
+            loadImage: { await ImageCache.shared.load($0) }
+        )
+    }
+
+    func run() async -> Report {
+        let start = now()
+        let events: [EventResponse]
+        do {
+            events = try await fetchEvents()
+        } catch {
+            print("⚠️ Background refresh fetch failed: \(error.localizedDescription)")
+            return Report(fetched: 0, imagesDecoded: 0, duration: now() - start, completed: false)
+        }
+        guard !Task.isCancelled else {
+            return Report(fetched: 0, imagesDecoded: 0, duration: now() - start, completed: false)
+        }
+        persist(events)
+
+        // Live events lead the explore screen, so their images are decoded first;
+        // each group keeps the API order (`sorted` isn't stable)
+        let imageURLs = (events.filter(\.isLive) + events.filter { !$0.isLive })
+            .compactMap { $0.photographs?.first.flatMap(URL.init(string:)) }
+            .prefix(imageCount)
+
+        var decoded = 0
+        var completed = true
+        for url in imageURLs {
+            guard !Task.isCancelled, now() - start < deadline else {
+                completed = false
+                break
+            }
+            if await loadImage(url) != nil {
+                decoded += 1
+            }
+        }
+
+        let report = Report(fetched: events.count, imagesDecoded: decoded, duration: now() - start, completed: completed)
+        print("🌙 Background refresh: \(report.fetched) events, \(report.imagesDecoded) images in \(String(format: "%.1f", report.duration))s\(completed ? "" : " (stopped early)")")
+        return report
+    }
+}
+
+// MARK: - Background Refresh
+/// BGAppRefreshTask that runs `EventPrewarmer` while the app is in the background
+enum BackgroundRefresh {
+    /// Must match `BGTaskSchedulerPermittedIdentifiers` in Talkeys-IOS-Info.plist
+    static let taskIdentifier = "com.talkeys.ios.Talkeys-IOS.eventRefresh"
+    /// Earliest the system may run the next refresh
+    static let minimumInterval: TimeInterval = 60 * 60
+
+    /// Register the launch handler; must happen before the app finishes launching.
+    /// Idempotent, since registering an identifier twice raises an exception.
+    static func register() {
+        _ = registration
+    }
+
+    private static let registration: Void = {
+        let registered = BGTaskScheduler.shared.register(forTaskWithIdentifier: taskIdentifier, using: nil) { task in
+            guard let refreshTask = task as? BGAppRefreshTask else {
+                task.setTaskCompleted(success: false)
+                return
+            }
+            handle(refreshTask)
+        }
+        if !registered {
+            print("⚠️ Background refresh task not registered; check BGTaskSchedulerPermittedIdentifiers")
+        }
+    }()
+
+    /// Ask for the next refresh; called when the app moves to the background
+    static func schedule() {
+        let request = BGAppRefreshTaskRequest(identifier: taskIdentifier)
+        request.earliestBeginDate = Date(timeIntervalSinceNow: minimumInterval)
+        do {
+            try BGTaskScheduler.shared.submit(request)
+        } catch {
+            print("⚠️ Could not schedule background refresh: \(error.localizedDescription)")
+        }
+    }
+
+    // MARK: - Private Helpers
+
+    private static func handle(_ task: BGAppRefreshTask) {
+        // Keep the chain going whatever this run's outcome
+        schedule()
+
+        let work = Task.detached(priority: .utility) {
+            let report = await EventPrewarmer.live().run()
+            task.setTaskCompleted(success: report.fetched > 0)
+        }
+        // The system is about to suspend us: stop at the next image boundary
+        task.expirationHandler = {
+            work.cancel()
+        }
+    }
+}
@@ -0,0 +1,293 @@
+import Foundation
+
+// MARK: - Cache Priority
+/// Order in which caches give memory back; `.low` is shed first
+enum CachePriority: Int, Comparable, CaseIterable {
+    /// Cheap to rebuild (formatted strings, search results)
+    case low
+    /// Costs a network or disk round trip to rebuild (decoded images)
+    case medium
+    /// What's on screen right now (the event list)
+    case high
+
+    static func < (lhs: CachePriority, rhs: CachePriority) -> Bool {
+        lhs.rawValue < rhs.rawValue
+    }
+}
+
+// MARK: - Memory Pressure
+enum MemoryPressure {
+    /// Dispatch `.warning` event; the same condition UIKit reports as a memory warning
+    case warning
+    /// Dispatch `.critical` event; the process is close to being killed
+    case critical
+}
+
+// MARK: - Managed Cache
+/// A cache that reports its resident bytes and can shrink on request
+protocol ManagedCache: AnyObject {
+    var name: String { get }
+    var priority: CachePriority { get }
+    var residentBytes: Int { get }
+    var entryCount: Int { get }
+    /// Evict least recently used entries until at most `bytes` remain
+    func trim(toBytes bytes: Int)
+}
+
+// MARK: - Cache Registry
+/// Every in-memory cache registers here. The registry keeps the sum of their costs under one
+/// global budget and sheds caches lowest priority first on memory pressure.
+final class CacheRegistry {
+    static let shared = CacheRegistry()
+
+    /// Global budget across all registered caches
+    let budgetBytes: Int
+
+    private let lock = NSLock()
+    private var caches: [WeakCache] = []
+    private var pressureSource: DispatchSourceMemoryPressure?
+
+    init(budgetBytes: Int = 48 * 1024 * 1024) {
+        self.budgetBytes = budgetBytes
+    }
+
+    func register(_ cache: ManagedCache) {
+        lock.lock()
+        caches.removeAll { $0.cache == nil || $0.cache === cache }
+        caches.append(WeakCache(cache: cache))
+        lock.unlock()
+    }
+
+    var registeredCaches: [ManagedCache] {
+        lock.lock()
+        defer { lock.unlock() }
+        return caches.compactMap(\.cache)
+    }
+
+    var residentBytes: Int {
+        registeredCaches.reduce(0) { $0 + $1.residentBytes }
+    }
+
+    // MARK: - Budget
+
+    /// Trim caches, lowest priority and largest first, until the total fits the budget.
+    /// Called by caches after an insert, outside their own locks.
+    func enforceBudget() {
+        var overflow = residentBytes - budgetBytes
+        guard overflow > 0 else { return }
+
+        for cache in sheddingOrder() where overflow > 0 {
+            let before = cache.residentBytes
+            cache.trim(toBytes: max(0, before - overflow))
+            overflow -= before - cache.residentBytes
+        }
+    }
+
+    // MARK: - Memory Pressure
+
+    /// Listen for dispatch memory-pressure events. UIKit's memory warning fires for the same
+    /// condition, so it isn't observed as well; each event sheds once.
+    func startMonitoring() {
+        lock.lock()
+        defer { lock.unlock() }
+        guard pressureSource == nil else { return }
+
+        let source = DispatchSource.makeMemoryPressureSource(eventMask: [.warning, .critical], queue: .global(qos: .utility))
+        source.setEventHandler { [weak self, weak source] in
+            guard let event = source?.data else { return }
+            self?.shed(event.contains(.critical) ? .critical : .warning)
+        }
+        source.resume()
+        pressureSource = source
+    }
+
+    /// A warning empties low-priority caches and halves medium ones; critical pressure empties
+    /// everything but high-priority caches, which are halved.
+    func shed(_ pressure: MemoryPressure) {
+        let before = residentBytes
+        for cache in sheddingOrder() {
+            switch (pressure, cache.priority) {
+            case (_, .low), (.critical, .medium):
+                cache.trim(toBytes: 0)
+            case (.warning, .medium), (.critical, .high):
+                cache.trim(toBytes: cache.residentBytes / 2)
+            case (.warning, .high):
+                break
+            }
+        }
+        print("🧹 Memory \(pressure == .critical ? "critical" : "warning"): shed \(CacheRegistry.format(before - residentBytes)), \(CacheRegistry.format(residentBytes)) resident")
+    }
+
+    // MARK: - Reporting
+
+    func report() -> String {
+        let caches = registeredCaches.sorted { $0.residentBytes > $1.residentBytes }
+        let total = caches.reduce(0) { $0 + $1.residentBytes }
+        var lines = ["🗃️ Cache residency: \(CacheRegistry.format(total)) of \(CacheRegistry.format(budgetBytes)) budget"]
+        for cache in caches {
+            lines.append("   \(cache.name) [\(cache.priority)] — \(CacheRegistry.format(cache.residentBytes)), \(cache.entryCount) entries")
+        }
+        return lines.joined(separator: "\n")
+    }
+
+    static func format(_ bytes: Int) -> String {
+        ByteCountFormatter.string(fromByteCount: Int64(bytes), countStyle: .memory)
+    }
+
+    // MARK: - Private Helpers
+
+    private func sheddingOrder() -> [ManagedCache] {
+        registeredCaches.sorted {
+            $0.priority != $1.priority ? $0.priority < $1.priority : $0.residentBytes > $1.residentBytes
+        }
+    }
+
+    private struct WeakCache {
+        weak var cache: ManagedCache?
+    }
+}
+
+// MARK: - Cost Cache
+/// Thread-safe LRU cache whose entries carry a byte cost. It keeps itself under its own
+/// `limitBytes` and registers with `CacheRegistry` for the global budget and memory pressure.
+/// Entries sit in a doubly linked list, most recently used first, so lookups, inserts and
+/// each eviction are O(1).
+final class CostCache<Key: Hashable, Value>: ManagedCache {
+    let name: String
+    let priority: CachePriority
+    let limitBytes: Int
+
+    private let cost: (Key, Value) -> Int
+    private let registry: CacheRegistry
+    private let lock = NSLock()
+    private var nodes: [Key: Node] = [:]
+    private var totalCost = 0
+    /// Most recently used
+    private var head: Node?
+    /// Least recently used; evicted first
+    private var tail: Node?
+
+    private final class Node {
+        let key: Key
+        let value: Value
+        let cost: Int
+        weak var previous: Node?
+        var next: Node?
+
+        init(key: Key, value: Value, cost: Int) {
+            self.key = key
+            self.value = value
+            self.cost = cost
+        }
+    }
+
+    init(name: String, priority: CachePriority, limitBytes: Int, registry: CacheRegistry = .shared, cost: @escaping (Key, Value) -> Int) {
+        self.name = name
+        self.priority = priority
+        self.limitBytes = limitBytes
+        self.registry = registry
+        self.cost = cost
+        registry.register(self)
+    }
+
+    var residentBytes: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return totalCost
+    }
+
+    var entryCount: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return nodes.count
+    }
+
+    func value(for key: Key) -> Value? {
+        lock.lock()
+        defer { lock.unlock() }
+        guard let node = nodes[key] else { return nil }
+        unlink(node)
+        pushFront(node)
+        return node.value
+    }
+
+    func insert(_ value: Value, for key: Key) {
+        let entryCost = cost(key, value)
+        guard entryCost <= limitBytes else { return }
+
+        lock.lock()
+        if let previous = nodes[key] {
+            unlink(previous)
+            totalCost -= previous.cost
+        }
+        let node = Node(key: key, value: value, cost: entryCost)
+        nodes[key] = node
+        pushFront(node)
+        totalCost += entryCost
+        evict(toBytes: limitBytes)
+        lock.unlock()
+
+        registry.enforceBudget()
+    }
+
+    func removeValue(for key: Key) {
+        lock.lock()
+        if let removed = nodes.removeValue(forKey: key) {
+            unlink(removed)
+            totalCost -= removed.cost
+        }
+        lock.unlock()
+    }
+
+    func removeAll() {
+        trim(toBytes: 0)
+    }
+
+    func trim(toBytes bytes: Int) {
+        lock.lock()
+        evict(toBytes: bytes)
+        lock.unlock()
+    }
+
+    // MARK: - LRU List (caller holds `lock`)
+
+    private func evict(toBytes bytes: Int) {
+        guard totalCost > bytes else { return }
+        if bytes <= 0 {
+            nodes.removeAll()
+            head = nil
+            tail = nil
+            totalCost = 0
+            return
+        }
+        while totalCost > bytes, let leastRecent = tail {
+            unlink(leastRecent)
+            nodes.removeValue(forKey: leastRecent.key)
+            totalCost -= leastRecent.cost
+        }
+    }
+
+    private func pushFront(_ node: Node) {
+        node.next = head
+        head?.previous = node
+        head = node
+        if tail == nil {
+            tail = node
+        }
+    }
+
+    private func unlink(_ node: Node) {
+        if let previous = node.previous {
+            previous.next = node.next
+        } else if head === node {
+            head = node.next
+        }
+        if let next = node.next {
+            next.previous = node.previous
+        } else if tail === node {
+            tail = node.previous
+        }
+        node.previous = nil
+        node.next = nil
+    }
+}
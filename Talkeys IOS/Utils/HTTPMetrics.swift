@@ -0,0 +1,202 @@
+import Foundation
+import Combine
+
+// MARK: - HTTP Phase
+/// Stages of one request, taken from `URLSessionTaskTransactionMetrics`
+enum HTTPPhase: String, CaseIterable {
+    case dns, connect, tls, send, wait, receive
+}
+
+// MARK: - Endpoint Metrics
+/// Aggregated counters for one endpoint template, e.g. "getEventById/{id}"
+struct EndpointMetrics {
+    let template: String
+    var requests = 0
+    var failures = 0
+    var reusedConnections = 0
+    var cacheHits = 0
+    var bytesSent: Int64 = 0
+    var bytesReceived: Int64 = 0
+    var totalMilliseconds: Double = 0
+    var maxMilliseconds: Double = 0
+    var phaseMilliseconds: [HTTPPhase: Double] = [:]
+
+    var averageMilliseconds: Double {
+        requests == 0 ? 0 : totalMilliseconds / Double(requests)
+    }
+
+    func averageMilliseconds(for phase: HTTPPhase) -> Double {
+        requests == 0 ? 0 : (phaseMilliseconds[phase] ?? 0) / Double(requests)
+    }
+}
+
+// MARK: - HTTP Metrics
+/// Per-endpoint latency, phase timings and byte counts for app traffic.
+/// `snapshot` always holds the latest aggregate and publishes on every change, so SwiftUI or a
+/// debug overlay can observe it the way a Kotlin `StateFlow` would be collected.
+final class HTTPMetrics {
+    static let shared = HTTPMetrics()
+
+    let snapshot = CurrentValueSubject<[String: EndpointMetrics], Never>([:])
+
+    private let lock = NSLock()
+    private var metrics: [String: EndpointMetrics] = [:]
+
+    // MARK: - Recording
+
+    /// Record a URLSession request; phases and bytes come from the task metrics when available
+    func record(template: String, duration: TimeInterval, failed: Bool, taskMetrics: URLSessionTaskMetrics?) {
+        update(template) { entry in
+            entry.add(duration: duration, failed: failed)
+            guard let transaction = taskMetrics?.transactionMetrics.last else { return }
+
+            if transaction.isReusedConnection { entry.reusedConnections += 1 }
+            if transaction.resourceFetchType == .localCache { entry.cacheHits += 1 }
+            entry.bytesSent += transaction.countOfRequestHeaderBytesSent + transaction.countOfRequestBodyBytesSent
+            entry.bytesReceived += transaction.countOfResponseHeaderBytesReceived + transaction.countOfResponseBodyBytesReceived
+
+            for phase in HTTPPhase.allCases {
+                if let milliseconds = HTTPMetrics.milliseconds(of: phase, in: transaction) {
+                    entry.phaseMilliseconds[phase, default: 0] += milliseconds
+                }
+            }
+        }
+    }
+
+    /// Time calls that don't go through `HTTPClient`, such as sharedKit's `AuthRepository`
+    func measure<T>(template: String, _ operation: () async throws -> T) async rethrows -> T {
+        let start = CFAbsoluteTimeGetCurrent()
+        do {
+            let result = try await operation()
+            update(template) { $0.add(duration: CFAbsoluteTimeGetCurrent() - start, failed: false) }
+            return result
+        } catch {
+            update(template) { $0.add(duration: CFAbsoluteTimeGetCurrent() - start, failed: true) }
+            throw error
+        }
+    }
+
+    // MARK: - Reporting
+
+    func reset() {
+        lock.lock()
+        metrics.removeAll()
+        lock.unlock()
+        snapshot.send([:])
+    }
+
+    func report() -> String {
+        var lines = ["🌐 HTTP metrics:"]
+        for entry in snapshot.value.values.sorted(by: { $0.totalMilliseconds > $1.totalMilliseconds }) {
+            let phases = HTTPPhase.allCases
+                .filter { entry.phaseMilliseconds[$0] != nil }
+                .map { "\($0.rawValue) \(String(format: "%.1f", entry.averageMilliseconds(for: $0)))" }
+                .joined(separator: ", ")
+            lines.append("   \(entry.template) — \(entry.requests)x (\(entry.failures) failed), avg \(String(format: "%.1f", entry.averageMilliseconds))ms, max \(String(format: "%.1f", entry.maxMilliseconds))ms, \(entry.bytesSent)B out / \(entry.bytesReceived)B in, \(entry.reusedConnections) reused, \(entry.cacheHits) cached" + (phases.isEmpty ? "" : " [\(phases)]"))
+        }
+        return lines.joined(separator: "\n")
+    }
+
+    func printReport() {
+        print(report())
+    }
+
+    // MARK: - Endpoint Templates
+
+    /// Collapse id-like path segments so "getEventById/66f0c1…" aggregates as "getEventById/{id}"
+    static func template(for url: URL) -> String {
+        url.pathComponents
+            .filter { $0 != "/" }
+            .map { isIdentifier($0) ? "{id}" : $0 }
+            .joined(separator: "/")
+    }
+
+    private static func isIdentifier(_ segment: String) -> Bool {
+        Int(segment) != nil || UUID(uuidString: segment) != nil || (segment.count >= 8 && segment.contains(where: \.isNumber))
+    }
+
+    // MARK: - Private Helpers
+
+    private func update(_ template: String, _ body: (inout EndpointMetrics) -> Void) {
+        lock.lock()
+        var entry = metrics[template] ?? EndpointMetrics(template: template)
+        body(&entry)
+        metrics[template] = entry
+        let current = metrics
+        lock.unlock()
+        snapshot.send(current)
+    }
+
+    private static func milliseconds(of phase: HTTPPhase, in transaction: URLSessionTaskTransactionMetrics) -> Double? {
+        let interval: (Date?, Date?)
+        switch phase {
+        case .dns: interval = (transaction.domainLookupStartDate, transaction.domainLookupEndDate)
+        case .connect: interval = (transaction.connectStartDate, transaction.secureConnectionStartDate ?? transaction.connectEndDate)
+        case .tls: interval = (transaction.secureConnectionStartDate, transaction.secureConnectionEndDate)
+        case .send: interval = (transaction.requestStartDate, transaction.requestEndDate)
+        case .wait: interval = (transaction.requestEndDate, transaction.responseStartDate)
+        case .receive: interval = (transaction.responseStartDate, transaction.responseEndDate)
+        }
+        guard let start = interval.0, let end = interval.1 else { return nil }
+        return end.timeIntervalSince(start) * 1000
+    }
+}
+
+private extension EndpointMetrics {
+    mutating func add(duration: TimeInterval, failed: Bool) {
+        let milliseconds = duration * 1000
+        requests += 1
+        if failed { failures += 1 }
+        totalMilliseconds += milliseconds
+        maxMilliseconds = max(maxMilliseconds, milliseconds)
+    }
+}
+
+// MARK: - Metrics Collector
+/// Per-task delegate that hands the task's metrics to `HTTPClient`.
+/// URLSession may call `didFinishCollecting` just after `data(for:)` returns, so the client
+/// awaits it rather than reading whatever has arrived by then.
+final class HTTPMetricsCollector: NSObject, URLSessionTaskDelegate {
+    private let lock = NSLock()
+    private var collected: URLSessionTaskMetrics?
+    private var isFinished = false
+    private var waiter: CheckedContinuation<URLSessionTaskMetrics?, Never>?
+
+    /// The task's metrics once delivered, or nil if they don't arrive within `timeout`
+    func taskMetrics(timeout: TimeInterval) async -> URLSessionTaskMetrics? {
+        await withCheckedContinuation { continuation in
+            lock.lock()
+            guard !isFinished else {
+                let metrics = collected
+                lock.unlock()
+                continuation.resume(returning: metrics)
+                return
+            }
+            waiter = continuation
+            lock.unlock()
+
+            DispatchQueue.global().asyncAfter(deadline: .now() + timeout) {
+                self.finish(with: nil)
+            }
+        }
+    }
+
+    func urlSession(_ session: URLSession, task: URLSessionTask, didFinishCollecting metrics: URLSessionTaskMetrics) {
+        finish(with: metrics)
+    }
+
+    /// First call wins: late metrics after a timeout are dropped, and the waiter resumes once
+    private func finish(with metrics: URLSessionTaskMetrics?) {
+        lock.lock()
+        guard !isFinished else {
+            lock.unlock()
+            return
+        }
+        isFinished = true
+        collected = metrics
+        let waiting = waiter
+        waiter = nil
+        lock.unlock()
+        waiting?.resume(returning: metrics)
+    }
+}
@@ -0,0 +1,71 @@
+import Foundation
+import UIKit
+
+// MARK: - Image Cache
+/// Decoded images keyed by URL, costed by their bitmap size and registered with `CacheRegistry`.
+/// Downloads go through `HTTPClient` as `.media`, concurrent loads of one URL share a task, and
+/// decoding happens off main so the first draw doesn't stall scrolling.
+final class ImageCache {
+    static let shared = ImageCache()
+
+    private let cache: CostCache<URL, UIImage>
+    private let client: HTTPClient
+    private let lock = NSLock()
+    private var inFlight: [URL: Task<UIImage?, Never>] = [:]
+
+    init(limitBytes: Int = 32 * 1024 * 1024, client: HTTPClient = .shared, registry: CacheRegistry = .shared) {
+        self.client = client
+        self.cache = CostCache(name: "images", priority: .medium, limitBytes: limitBytes, registry: registry) { _, image in
+            ImageCache.cost(of: image)
+        }
+    }
+
+    /// Memory-only lookup, cheap enough for a view initializer
+    func image(for url: URL) -> UIImage? {
+        cache.value(for: url)
+    }
+
+    /// Cached image, or download and decode it. Returns nil when the download or decode fails.
+    func load(_ url: URL) async -> UIImage? {
+        if let cached = cache.value(for: url) {
+            return cached
+        }
+
+        lock.lock()
+        if let existing = inFlight[url] {
+            lock.unlock()
+            return await existing.value
+        }
+        let task = Task.detached(priority: .utility) { [client, cache] () -> UIImage? in
+            do {
+                let (data, _) = try await client.data(for: URLRequest(url: url), endpoint: .media, template: "image")
+                guard let image = UIImage(data: data)?.preparingForDisplay() else { return nil }
+                cache.insert(image, for: url)
+                return image
+            } catch {
+                print("⚠️ Image load failed for \(url.lastPathComponent): \(error.localizedDescription)")
+                return nil
+            }
+        }
+        inFlight[url] = task
+        lock.unlock()
+
+        let image = await task.value
+        lock.lock()
+        inFlight[url] = nil
+        lock.unlock()
+        return image
+    }
+
+    func removeAll() {
+        cache.removeAll()
+    }
+
+    /// Bytes of the decoded bitmap
+    static func cost(of image: UIImage) -> Int {
+        if let cgImage = image.cgImage {
+            return cgImage.bytesPerRow * cgImage.height
+        }
+        return Int(image.size.width * image.scale * image.size.height * image.scale) * 4
+    }
+}
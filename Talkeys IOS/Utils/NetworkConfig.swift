@@ -55,8 +55,8 @@ class NetworkUtils {
         request.setValue("iOS", forHTTPHeaderField: "Platform")
         request.setValue(Bundle.main.infoDictionary?["CFBundleShortVersionString"] as? String ?? "1.0", forHTTPHeaderField: "App-Version")
         
-        // Add authorization header if available
-        if let token = UserDefaults.standard.string(forKey: "auth_token") {
+        // Add authorization header if available (in-memory read)
+        if let token = TokenVault.shared.currentToken {
             request.setValue("Bearer \(token)", forHTTPHeaderField: "Authorization")
         }
         
@@ -214,8 +214,8 @@ class RequestBuilder {
         // Set default headers
         request.setValue("application/json", forHTTPHeaderField: "Content-Type")
         
-        // Add auth token if available
-        if let token = UserDefaults.standard.string(forKey: "auth_token") {
+        // Add auth token if available (in-memory read)
+        if let token = TokenVault.shared.currentToken {
             request.setValue("Bearer \(token)", forHTTPHeaderField: "Authorization")
         }
         
@@ -0,0 +1,140 @@
+import Foundation
+import os
+
+// MARK: - Startup Priority
+enum StartupPriority: String {
+    /// Runs synchronously before the first frame is rendered
+    case critical
+    /// Runs after the first frame, in registration order
+    case deferred
+}
+
+// MARK: - Startup Stage
+struct StartupStage {
+    let name: String
+    let priority: StartupPriority
+    /// Deferred stages run on a background queue unless they must touch main-thread-only APIs
+    let runsOnMain: Bool
+    let work: () -> Void
+}
+
+struct StartupStageTiming {
+    let name: String
+    let priority: StartupPriority
+    let duration: TimeInterval
+}
+
+// MARK: - Startup Orchestrator
+/// Runs launch work in a prioritized, measured sequence.
+/// Only critical stages block the first frame; everything else is deferred until the UI is on screen.
+/// Each stage is wrapped in a signpost interval so it shows up in Instruments under the "Startup" category.
+final class StartupOrchestrator {
+    static let shared = StartupOrchestrator()
+
+    /// Time the critical path should stay under before the first frame; overruns are logged
+    static let criticalPathBudget: TimeInterval = 0.1
+
+    private let signposter = OSSignposter(subsystem: Bundle.main.bundleIdentifier ?? "Talkeys", category: "Startup")
+    private let deferredQueue = DispatchQueue(label: "StartupDeferred", qos: .utility)
+    private let lock = NSLock()
+
+    private var stages: [StartupStage] = []
+    private var recordedTimings: [StartupStageTiming] = []
+    private var hasRunDeferredStages = false
+
+    init() {}
+
+    // MARK: - Registration
+
+    func register(_ name: String, priority: StartupPriority, runsOnMain: Bool = false, work: @escaping () -> Void) {
+        lock.lock()
+        stages.append(StartupStage(name: name, priority: priority, runsOnMain: runsOnMain, work: work))
+        lock.unlock()
+    }
+
+    // MARK: - Execution
+
+    /// Run all critical stages synchronously on the calling thread (the app's init)
+    func runCriticalPath() {
+        for stage in stages(with: .critical) {
+            run(stage)
+        }
+        print("🚀 Critical startup path finished in \(String(format: "%.1f", criticalPathDuration * 1000))ms")
+        if criticalPathDuration > StartupOrchestrator.criticalPathBudget {
+            print("⚠️ Critical startup path is over its \(Int(StartupOrchestrator.criticalPathBudget * 1000))ms budget")
+        }
+    }
+
+    /// Run deferred stages once the first frame is up. Safe to call more than once.
+    func runDeferredStages(completion: (() -> Void)? = nil) {
+        lock.lock()
+        let alreadyRun = hasRunDeferredStages
+        hasRunDeferredStages = true
+        lock.unlock()
+
+        guard !alreadyRun else {
+            completion?()
+            return
+        }
+
+        let deferredStages = stages(with: .deferred)
+        deferredQueue.async { [weak self] in
+            for stage in deferredStages {
+                if stage.runsOnMain {
+                    DispatchQueue.main.sync { self?.run(stage) }
+                } else {
+                    self?.run(stage)
+                }
+            }
+            self?.printReport()
+            completion?()
+        }
+    }
+
+    /// Registered stage names at one priority, in the order they will run
+    func stageNames(_ priority: StartupPriority) -> [String] {
+        stages(with: priority).map(\.name)
+    }
+
+    // MARK: - Timings
+
+    var timings: [StartupStageTiming] {
+        lock.lock()
+        defer { lock.unlock() }
+        return recordedTimings
+    }
+
+    var criticalPathDuration: TimeInterval {
+        timings.filter { $0.priority == .critical }.reduce(0) { $0 + $1.duration }
+    }
+
+    func printReport() {
+        print("📊 Startup stage timings:")
+        for timing in timings {
+            print("   [\(timing.priority.rawValue)] \(timing.name): \(String(format: "%.1f", timing.duration * 1000))ms")
+        }
+    }
+
+    // MARK: - Private Helpers
+
+    private func stages(with priority: StartupPriority) -> [StartupStage] {
+        lock.lock()
+        defer { lock.unlock() }
+        return stages.filter { $0.priority == priority }
+    }
+
+    private func run(_ stage: StartupStage) {
+        let signpostID = signposter.makeSignpostID()
+        let state = signposter.beginInterval("StartupStage", id: signpostID, "\(stage.name, privacy: .public)")
+        let start = DispatchTime.now().uptimeNanoseconds
+
+        stage.work()
+
+        let duration = TimeInterval(DispatchTime.now().uptimeNanoseconds - start) / 1_000_000_000
+        signposter.endInterval("StartupStage", state)
+
+        lock.lock()
+        recordedTimings.append(StartupStageTiming(name: stage.name, priority: stage.priority, duration: duration))
+        lock.unlock()
+    }
+}
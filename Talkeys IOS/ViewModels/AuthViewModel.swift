@@ -4,9 +4,6 @@ import GoogleSignIn
 import UIKit
 import sharedKit
 
-// Use sharedKit.User instead of local User model
-typealias User = sharedKit.User
-
 @MainActor
 class AuthViewModel: ObservableObject {
     
@@ -14,29 +11,25 @@ class AuthViewModel: ObservableObject {
     @Published var isLoggedIn = false
     @Published var isLoading = false
     @Published var isCheckingToken = true
-    @Published var currentUser: User?
+    @Published var currentUser: AppUser?
     @Published var errorMessage: String?
     @Published var showToast = false
     @Published var toastMessage = ""
     
     // MARK: - Private Properties
-    private let authRepository: AuthRepository
     private var cancellables = Set<AnyCancellable>()
+    private var authStateObservation: Task<Void, Never>?
+    private let container: AppContainer
+    
+    /// Resolved on first use so creating the view model never blocks the first frame
+    private var authRepository: AuthRepository {
+        container.authRepository
+    }
     
     // MARK: - Initialization
-    init() {
-        // Initialize shared KMP authentication safely
-        KoinInitializer.shared.initializeKoin()
-        
-        let apiClient = ApiClient()
-        let googleSignInProvider = IOSGoogleSignInProvider()
-        let tokenStorage = IOSTokenStorage()
-        
-        self.authRepository = AuthRepository(
-            httpClient: apiClient.httpClient,
-            googleSignInProvider: googleSignInProvider,
-            tokenStorage: tokenStorage
-        )
+    /// Views should use `AppContainer.shared.authViewModel` so auth state is shared across screens
+    init(container: AppContainer = .shared) {
+        self.container = container
         
         // Don't automatically check auth on init to prevent loops
         // checkExistingAuth() will be called manually when needed
@@ -44,52 +37,85 @@ class AuthViewModel: ObservableObject {
     
     // MARK: - Public Methods
     
+    /// Restore the last known user from the local database.
+    /// The session state is set now; the user is read on the auth IO queue, since the database
+    /// opens after the first frame, and is shown as soon as it loads.
+    func restoreCachedSession() {
+        guard TokenManager.shared.isTokenValid() else { return }
+        
+        isLoggedIn = true
+        isCheckingToken = false
+        guard currentUser == nil else { return }
+        
+        let container = self.container
+        Task { [weak self] in
+            let cachedUser = await AuthDispatch.io { container.userProfileStore.cachedUser() }
+            // A backend answer that landed meanwhile is newer than the cache
+            guard let self = self, self.currentUser == nil, let cachedUser = cachedUser else { return }
+            self.currentUser = cachedUser
+            print("⚡️ Restored cached user: \(cachedUser.name)")
+        }
+    }
+    
     /// Check if user has existing valid authentication
+    /// The cached profile is shown immediately; backend validation runs concurrently and only
+    /// replaces it (or signs out) when it answers.
     func checkExistingAuth() {
-        Task {
-            isCheckingToken = true
+        restoreCachedSession()
+        
+        // Quick local token validation first
+        guard TokenManager.shared.isTokenValid() else {
+            // No valid token, show login screen
+            print("❌ No valid token found")
+            isLoggedIn = false
+            currentUser = nil
+            isCheckingToken = false
+            GoogleSignInManager.shared.updateSignInStatus(false)
+            return
+        }
+        
+        observeSharedAuthState()
+        
+        // Backend check and persistence run off main; the result lands in one main-actor hop.
+        // The profile store is resolved here too, so a database still opening never blocks main.
+        let repository = authRepository
+        let container = self.container
+        Task.detached(priority: .userInitiated) { [weak self] in
+            let profileStore = container.userProfileStore
+            let trace = AuthFlowTrace("validateSession")
+            print("🔍 Valid token found, validating with backend in background...")
             
-            // Quick local token validation first
-            if TokenManager.shared.isTokenValid() {
-                print("🔍 Valid token found, checking with backend...")
+            do {
+                let authState = try await HTTPMetrics.shared.measure(template: "auth/checkExistingAuth") {
+                    try await repository.currentAuthState()
+                }
+                trace.mark("authChecked")
                 
-                do {
-                    let authState = try await authRepository.checkExistingAuth()
+                if let successState = authState as? AuthState.Success {
+                    // User already logged in
+                    print("✅ Backend authentication successful for: \(successState.user.name)")
                     
-                    if let successState = authState as? AuthState.Success {
-                        // User already logged in
-                        print("✅ Backend authentication successful for: \(successState.user.name)")
-                        
-                        await updateAuthState(
-                            isLoggedIn: true,
-                            user: successState.user,
-                            message: "Welcome back \(successState.user.name)!"
-                        )
-                        
-                        GoogleSignInManager.shared.updateSignInStatus(true)
-                        
-                        // Show welcome message briefly (only if not in main app check)
-                        if !isCheckingToken {
-                            await showToastMessage("Welcome back \(successState.user.name)!")
-                        }
-                    } else {
-                        // Token exists but auth failed, clear it
-                        print("❌ Backend authentication failed, clearing token")
-                        await handleAuthFailure("Authentication expired")
-                    }
-                } catch {
+                    let user = AppUser(successState.user)
+                    await AuthDispatch.io { profileStore.save(user) }
+                    trace.mark("persisted")
+                    
+                    await self?.applySignedIn(user, message: "Welcome back \(user.name)!", trace: trace)
+                } else {
+                    // Token exists but auth failed, clear it
+                    print("❌ Backend authentication failed, clearing token")
+                    await self?.handleAuthFailure("Authentication expired", trace: trace)
+                }
+            } catch {
+                if profileStore.cachedUser() != nil {
+                    // Likely offline: keep the cached session rather than signing the user out
+                    print("⚠️ Could not reach backend, keeping cached session: \(error.localizedDescription)")
+                    await self?.finishValidation(trace: trace)
+                } else {
                     // Error checking auth, clear token and show login
                     print("❌ Error checking authentication: \(error.localizedDescription)")
-                    await handleAuthFailure("Authentication check failed")
+                    await self?.handleAuthFailure("Authentication check failed", trace: trace)
                 }
-            } else {
-                // No valid token, show login screen
-                print("❌ No valid token found")
-                await updateAuthState(isLoggedIn: false, user: nil)
-                GoogleSignInManager.shared.updateSignInStatus(false)
             }
-            
-            isCheckingToken = false
         }
     }
     
@@ -118,100 +144,95 @@ class AuthViewModel: ObservableObject {
         
         // Use native Google Sign-In SDK directly
         print("🚀 Calling GIDSignIn.sharedInstance.signIn...")
+        let pipeline = SignInPipeline(container: container)
         GIDSignIn.sharedInstance.signIn(withPresenting: presentingViewController) { [weak self] result, error in
             print("📲 Google Sign-In callback received")
+            let trace = AuthFlowTrace("googleSignIn")
             
-            Task { @MainActor in
-                self?.isLoading = false
-                
-                if let error = error {
-                    print("❌ Google Sign-In error: \(error.localizedDescription)")
-                    await self?.handleAuthFailure("Google Sign-In failed: \(error.localizedDescription)")
-                    return
+            if let error = error {
+                print("❌ Google Sign-In error: \(error.localizedDescription)")
+                Task { @MainActor in
+                    await self?.handleAuthFailure("Google Sign-In failed: \(error.localizedDescription)", trace: trace)
                 }
-                
-                guard let user = result?.user,
-                      let idToken = user.idToken?.tokenString,
-                      let profile = user.profile else {
-                    print("❌ Failed to get user data from Google")
-                    await self?.handleAuthFailure("Failed to get ID token from Google")
-                    return
+                return
+            }
+            
+            guard let user = result?.user,
+                  let idToken = user.idToken?.tokenString,
+                  let profile = user.profile else {
+                print("❌ Failed to get user data from Google")
+                Task { @MainActor in
+                    await self?.handleAuthFailure("Failed to get ID token from Google", trace: trace)
                 }
-                
-                let userName = profile.name ?? "User"
-                let userEmail = profile.email ?? ""
-                
-                print("✅ Google Sign-In successful for: \(userName)")
-                print("📧 Email: \(userEmail)")
-                print("🎫 ID Token: \(idToken.prefix(50))...")
-                
-                // Create a User object for our app using correct sharedKit.User initializer
-                let appUser = User(
-                    id: user.userID ?? UUID().uuidString,
-                    name: userName,
-                    email: userEmail,
-                    displayName: userName, // Use the same name as displayName
-                    profilePicture: profile.imageURL(withDimension: 200)?.absoluteString, // Get profile picture URL if available
-                    about: nil, // No about info from Google Sign-In
-                    pronouns: nil // No pronouns info from Google Sign-In
-                )
-                
-                // Save token locally
-                let tokenResult = TokenManager.shared.saveToken(idToken)
-                switch tokenResult {
-                case .success:
-                    print("✅ Token saved locally")
-                case .failure(let error):
-                    print("⚠️ Failed to save token locally: \(error)")
+                return
+            }
+            
+            let userName = profile.name ?? "User"
+            let userEmail = profile.email ?? ""
+            
+            print("✅ Google Sign-In successful for: \(userName)")
+            print("📧 Email: \(userEmail)")
+            print("🎫 ID Token: \(idToken.prefix(50))...")
+            
+            // Google Sign-In has no about or pronouns; displayName defaults to the name
+            let appUser = AppUser(
+                id: user.userID ?? UUID().uuidString,
+                name: userName,
+                email: userEmail,
+                profilePicture: profile.imageURL(withDimension: 200)?.absoluteString
+            )
+            
+            // Token handoff and database write run concurrently off main, then one hop applies
+            // the signed-in state; the avatar prefetch finishes on its own
+            Task.detached(priority: .userInitiated) {
+                do {
+                    let report = try await pipeline.run(idToken: idToken, user: appUser, trace: trace)
+                    await self?.applySignedIn(report.user, message: "Welcome \(userName)!", trace: trace)
+                    print("✅ Authentication flow completed successfully")
+
+                    // Show success message
+                    await self?.showToastMessage("Welcome \(userName)!")
+                } catch {
+                    await self?.handleAuthFailure("Failed to save sign-in: \(error.localizedDescription)", trace: trace)
                 }
-                
-                // Update auth state to trigger navigation
-                await self?.updateAuthState(
-                    isLoggedIn: true,
-                    user: appUser,
-                    message: "Welcome \(userName)!"
-                )
-                
-                // Update GoogleSignInManager status
-                GoogleSignInManager.shared.updateSignInStatus(true)
-                
-                // Show success message
-                await self?.showToastMessage("Welcome \(userName)!")
-                
-                print("✅ Authentication flow completed successfully")
             }
         }
     }
     
     /// Sign out user
     func signOut() {
-        Task {
-            isLoading = true
+        isLoading = true
+        
+        let repository = authRepository
+        let profileStore = container.userProfileStore
+        Task.detached(priority: .userInitiated) { [weak self] in
+            let trace = AuthFlowTrace("signOut")
             
             do {
                 // Sign out from shared KMP logic
-                try await authRepository.signOut()
-                
-                // Clear local token
-                let tokenResult = TokenManager.shared.clearToken()
-                switch tokenResult {
-                case .success:
-                    print("✅ Local token cleared")
-                case .failure(let error):
-                    print("⚠️ Failed to clear token: \(error.localizedDescription)")
+                try await HTTPMetrics.shared.measure(template: "auth/signOut") {
+                    try await repository.signOutCancellable()
                 }
+                trace.mark("sharedSignOut")
                 
-                // Update sign-in manager
-                GoogleSignInManager.shared.updateSignInStatus(false)
-                
-                // Update state
-                await updateAuthState(isLoggedIn: false, user: nil)
+                // Clear local token, profile and cached API responses on the IO queue
+                await AuthDispatch.io {
+                    let tokenResult = TokenManager.shared.clearToken()
+                    switch tokenResult {
+                    case .success:
+                        print("✅ Local token cleared")
+                    case .failure(let error):
+                        print("⚠️ Failed to clear token: \(error.localizedDescription)")
+                    }
+                    profileStore.clear()
+                    HTTPClient.shared.removeCachedResponses()
+                }
+                trace.mark("cleared")
                 
+                await self?.applySignedOut(trace: trace)
             } catch {
-                await handleAuthFailure("Sign-out failed: \(error.localizedDescription)")
+                await self?.handleAuthFailure("Sign-out failed: \(error.localizedDescription)", trace: trace)
             }
-            
-            isLoading = false
         }
     }
     
@@ -219,10 +240,12 @@ class AuthViewModel: ObservableObject {
     func loadUserData() {
         Task {
             do {
-                let authState = try await authRepository.checkExistingAuth()
+                let authState = try await HTTPMetrics.shared.measure(template: "auth/checkExistingAuth") {
+                    try await authRepository.currentAuthState()
+                }
                 
                 if let successState = authState as? AuthState.Success {
-                    currentUser = successState.user
+                    currentUser = AppUser(successState.user)
                 }
             } catch {
                 print("Error loading user data: \(error)")
@@ -233,24 +256,70 @@ class AuthViewModel: ObservableObject {
     
     // MARK: - Private Helper Methods
     
-    private func updateAuthState(isLoggedIn: Bool, user: User?, message: String? = nil) async {
-        self.isLoggedIn = isLoggedIn
-        self.currentUser = user
-        if let message = message {
-            self.toastMessage = message
+    /// Follow the shared module's `authState` so a sign-in completed in Kotlin reaches the UI.
+    /// Only successes are adopted; launch starts in `Idle` and must not clear a restored session.
+    private func observeSharedAuthState() {
+        guard authStateObservation == nil else { return }
+        let states = authRepository.authStates()
+        authStateObservation = Task { [weak self] in
+            for await state in states {
+                guard let self = self else { return }
+                if let successState = state as? AuthState.Success, self.currentUser?.id != successState.user.id {
+                    self.currentUser = AppUser(successState.user)
+                }
+            }
         }
-        self.errorMessage = nil
     }
     
-    private func handleAuthFailure(_ message: String) async {
-        // Clear any stored tokens
-        _ = TokenManager.shared.clearToken()
+    // MARK: - Main-Actor State Transitions
+    // Each auth flow ends in exactly one of these; persistence has already happened off main.
+    
+    private func applySignedIn(_ user: AppUser, message: String, trace: AuthFlowTrace) {
+        trace.mark("mainState")
+        isLoggedIn = true
+        currentUser = user
+        toastMessage = message
+        errorMessage = nil
+        isLoading = false
+        isCheckingToken = false
+        GoogleSignInManager.shared.updateSignInStatus(true)
+        trace.finish()
+    }
+    
+    private func applySignedOut(trace: AuthFlowTrace) {
+        trace.mark("mainState")
+        isLoggedIn = false
+        currentUser = nil
+        errorMessage = nil
+        isLoading = false
+        GoogleSignInManager.shared.updateSignInStatus(false)
+        trace.finish()
+    }
+    
+    private func finishValidation(trace: AuthFlowTrace) {
+        trace.mark("mainState")
+        isCheckingToken = false
+        trace.finish()
+    }
+    
+    private func handleAuthFailure(_ message: String, trace: AuthFlowTrace? = nil) async {
+        // Clear any stored tokens and the cached profile off main
+        let profileStore = container.userProfileStore
+        await AuthDispatch.io {
+            _ = TokenManager.shared.clearToken()
+            profileStore.clear()
+        }
+        trace?.mark("cleared")
         GoogleSignInManager.shared.updateSignInStatus(false)
         
         // Update state
         self.isLoggedIn = false
         self.currentUser = nil
         self.errorMessage = message
+        self.isLoading = false
+        self.isCheckingToken = false
+        trace?.mark("mainState")
+        trace?.finish()
         
         // Show error as toast
         await showToastMessage(message)
@@ -287,7 +356,7 @@ extension AuthViewModel {
     
     /// Get user initials for avatar
     var userInitials: String {
-        String(currentUser?.name.prefix(1).uppercased() ?? "U")
+        currentUser?.initials ?? "U"
     }
 }
 
@@ -295,12 +364,16 @@ extension AuthViewModel {
 class KoinInitializer {
     static let shared = KoinInitializer()
     private var isInitialized = false
+    private let lock = NSLock()
     
     private init() {}
     
+    /// Thread-safe: may be called from the deferred startup stage and from the main actor concurrently
     func initializeKoin() {
+        lock.lock()
+        defer { lock.unlock() }
+        
         guard !isInitialized else {
-            print("🔄 Koin already initialized, skipping...")
             return
         }
         
@@ -0,0 +1,38 @@
+import SwiftUI
+import Combine
+
+@MainActor
+class EventDetailViewModel: ObservableObject {
+
+    // MARK: - Published Properties (State)
+    /// Starts as the list snapshot (or a cached detail) so the screen renders on the first frame
+    @Published private(set) var event: EventResponse
+    @Published private(set) var isRefreshing = false
+    @Published var errorMessage: String?
+
+    // MARK: - Dependencies
+    private let loader: EventDetailLoader
+
+    // MARK: - Initialization
+    init(event: EventResponse, loader: EventDetailLoader = .shared) {
+        self.loader = loader
+        self.event = loader.snapshot(for: event)
+    }
+
+    // MARK: - Public Methods
+
+    /// Replace the snapshot with the full detail; a no-op network-wise when the detail was preloaded
+    func load(forceRefresh: Bool = false) async {
+        isRefreshing = true
+        defer { isRefreshing = false }
+
+        do {
+            event = try await loader.detail(for: event._id, forceRefresh: forceRefresh)
+            errorMessage = nil
+        } catch {
+            // The snapshot is still on screen, so a failed refresh is not fatal
+            print("⚠️ Event detail refresh failed: \(error.localizedDescription)")
+            errorMessage = "Couldn't refresh event details"
+        }
+    }
+}
@@ -1,6 +1,5 @@
 import SwiftUI
 import Combine
-import sharedKit
 
 @MainActor
 class HomeViewModel: ObservableObject {
@@ -149,7 +148,7 @@ class HomeViewModel: ObservableObject {
 // MARK: - Computed Properties
 extension HomeViewModel {
     /// Get current user from auth view model
-    var currentUser: User? {
+    var currentUser: AppUser? {
         authViewModel.currentUser
     }
     
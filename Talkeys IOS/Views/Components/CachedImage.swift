@@ -0,0 +1,37 @@
+import SwiftUI
+
+// MARK: - Cached Image
+/// `AsyncImage` replacement backed by `ImageCache`, so decoded images count toward the cache budget
+/// and are shed on memory pressure. A cached image renders on the first frame without a placeholder.
+struct CachedImage<Content: View, Placeholder: View>: View {
+    let url: URL?
+    private let content: (Image) -> Content
+    private let placeholder: () -> Placeholder
+
+    @State private var image: UIImage?
+
+    init(url: URL?, @ViewBuilder content: @escaping (Image) -> Content, @ViewBuilder placeholder: @escaping () -> Placeholder) {
+        self.url = url
+        self.content = content
+        self.placeholder = placeholder
+        _image = State(initialValue: url.flatMap(ImageCache.shared.image(for:)))
+    }
+
+    var body: some View {
+        Group {
+            if let image = image {
+                content(Image(uiImage: image))
+            } else {
+                placeholder()
+            }
+        }
+        .task(id: url) {
+            // A reused view keeps its @State; never show the previous URL's image under a new one
+            image = url.flatMap(ImageCache.shared.image(for:))
+            guard let url = url, image == nil else { return }
+            if let loaded = await ImageCache.shared.load(url), !Task.isCancelled {
+                image = loaded
+            }
+        }
+    }
+}
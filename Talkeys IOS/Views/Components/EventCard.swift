@@ -51,10 +51,14 @@ enum TicketPrice: Codable, Hashable {
     case int(Int)
     case string(String)
     case double(Double)
+    /// The API sent `null`; not the same as a free (0) event
+    case unknown
     
     init(from decoder: Decoder) throws {
         let container = try decoder.singleValueContainer()
-        if let intValue = try? container.decode(Int.self) {
+        if container.decodeNil() {
+            self = .unknown
+        } else if let intValue = try? container.decode(Int.self) {
             self = .int(intValue)
         } else if let doubleValue = try? container.decode(Double.self) {
             self = .double(doubleValue)
@@ -74,6 +78,8 @@ enum TicketPrice: Codable, Hashable {
             try container.encode(value)
         case .string(let value):
             try container.encode(value)
+        case .unknown:
+            try container.encodeNil()
         }
     }
     
@@ -85,17 +91,29 @@ enum TicketPrice: Codable, Hashable {
             return value
         case .string(let value):
             return Double(value)
+        case .unknown:
+            return nil
         }
     }
+    
+    /// "Free" only for an actual 0; a null or unreadable price is shown as not yet announced
+    var displayText: String {
+        guard let price = doubleValue else { return "Price TBA" }
+        return price == 0 ? "Free" : "₹\(Int(price))"
+    }
 }
 
 enum TotalSeats: Codable, Hashable {
     case int(Int)
     case string(String)
+    /// The API sent `null`
+    case unknown
     
     init(from decoder: Decoder) throws {
         let container = try decoder.singleValueContainer()
-        if let intValue = try? container.decode(Int.self) {
+        if container.decodeNil() {
+            self = .unknown
+        } else if let intValue = try? container.decode(Int.self) {
             self = .int(intValue)
         } else if let stringValue = try? container.decode(String.self) {
             self = .string(stringValue)
@@ -111,6 +129,8 @@ enum TotalSeats: Codable, Hashable {
             try container.encode(value)
         case .string(let value):
             try container.encode(value)
+        case .unknown:
+            try container.encodeNil()
         }
     }
     
@@ -120,6 +140,8 @@ enum TotalSeats: Codable, Hashable {
             return value
         case .string(let value):
             return Int(value)
+        case .unknown:
+            return nil
         }
     }
 }
@@ -146,7 +168,7 @@ struct EventCard: View {
     var body: some View {
         VStack(alignment: .leading, spacing: 0) {
             // Image Section
-            AsyncImage(url: URL(string: event.photographs?.first ?? "")) { image in
+            CachedImage(url: URL(string: event.photographs?.first ?? "")) { image in
                 image
                     .resizable()
                     .aspectRatio(contentMode: .fill)
@@ -195,10 +217,7 @@ struct EventCard: View {
                 HStack(spacing: 6) {
                     // Price Tag
                     TagView(
-                        text: {
-                            let priceValue = event.ticketPrice.doubleValue ?? 0.0
-                            return priceValue == 0.0 ? "Free" : "₹\(Int(priceValue))"
-                        }(),
+                        text: event.ticketPrice.displayText,
                         isFocused: isFocused
                     )
                     
@@ -240,8 +259,16 @@ struct EventCard: View {
         }
         .onLongPressGesture(minimumDuration: 0, maximumDistance: .infinity, pressing: { pressing in
             isPressed = pressing
+            if pressing {
+                // Press-down comes ~100ms before the tap; start the detail fetch now
+                EventDetailLoader.shared.preload(event)
+            }
         }, perform: {})
         .onAppear {
+            // Lazy rows create cards as they scroll into view, so this warms only what is on
+            // screen; the loader skips details it already has
+            EventDetailLoader.shared.preload(event)
+            
             // Entrance animation
             withAnimation(.spring(response: 0.6, dampingFraction: 0.8, blendDuration: 0)) {
                 slideOffset = 0
@@ -440,7 +467,23 @@ struct RoundedCorner: Shape {
 }
 
 // MARK: - Date Formatting Helper
+
+/// Formatted dates, shared by every card; cheap to rebuild so it is shed first under memory pressure
+private let formattedDateCache = CostCache<String, String>(name: "formattedDates", priority: .low, limitBytes: 256 * 1024) { key, value in
+    // UTF-8 storage for both strings plus dictionary entry overhead
+    key.utf8.count + value.utf8.count + 64
+}
+
 func formatDate(_ dateString: String) -> String {
+    if let cached = formattedDateCache.value(for: dateString) {
+        return cached
+    }
+    let formatted = formatDateUncached(dateString)
+    formattedDateCache.insert(formatted, for: dateString)
+    return formatted
+}
+
+private func formatDateUncached(_ dateString: String) -> String {
     let datePart = dateString.contains("T") ? String(dateString.split(separator: "T")[0]) : dateString
     let parts = datePart.split(separator: "-")
     
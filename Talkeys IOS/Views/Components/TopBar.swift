@@ -1,5 +1,4 @@
 import SwiftUI
-import sharedKit
 
 struct HomeTopBar: View {
     @ObservedObject var authViewModel: AuthViewModel
@@ -55,7 +54,7 @@ struct HomeTopBar: View {
 
 // Google User Avatar Component with profile picture
 struct GoogleUserAvatar: View {
-    let user: User?
+    let user: AppUser?
     let size: CGFloat
     
     var body: some View {
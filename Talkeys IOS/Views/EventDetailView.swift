@@ -0,0 +1,107 @@
+import SwiftUI
+
+// MARK: - Event Detail View
+struct EventDetailView: View {
+    @StateObject private var viewModel: EventDetailViewModel
+    @Environment(\.presentationMode) private var presentationMode
+
+    init(event: EventResponse) {
+        _viewModel = StateObject(wrappedValue: EventDetailViewModel(event: event))
+    }
+
+    private var event: EventResponse { viewModel.event }
+
+    var body: some View {
+        ZStack(alignment: .topTrailing) {
+            Color(red: 18/255, green: 18/255, blue: 18/255)
+                .ignoresSafeArea()
+
+            ScrollView {
+                VStack(alignment: .leading, spacing: 16) {
+                    heroImage
+
+                    VStack(alignment: .leading, spacing: 12) {
+                        Text(event.name)
+                            .font(.custom("Urbanist-Regular", size: 24))
+                            .fontWeight(.bold)
+                            .foregroundColor(.white)
+
+                        detailRow(icon: "calendar", text: "\(formatDate(event.startDate)) | \(event.startTime)")
+                        detailRow(icon: "location.fill", text: event.location ?? "Location not available")
+                        detailRow(icon: "clock", text: event.duration)
+
+                        HStack(spacing: 6) {
+                            TagView(text: priceText, isFocused: true)
+                            TagView(text: event.category, isFocused: true)
+                            TagView(text: event.mode, isFocused: true)
+                        }
+
+                        if let description = event.eventDescription, !description.isEmpty {
+                            Text(description)
+                                .font(.system(size: 14))
+                                .foregroundColor(.white.opacity(0.85))
+                                .padding(.top, 4)
+                        }
+
+                        if let organizer = event.organizerName, !organizer.isEmpty {
+                            detailRow(icon: "person.fill", text: "Organized by \(organizer)")
+                        }
+
+                        if viewModel.isRefreshing {
+                            ProgressView()
+                                .progressViewStyle(CircularProgressViewStyle(tint: .white))
+                        } else if let error = viewModel.errorMessage {
+                            Text(error)
+                                .font(.system(size: 12))
+                                .foregroundColor(.white.opacity(0.6))
+                        }
+                    }
+                    .padding(.horizontal, 16)
+                }
+                .padding(.bottom, 40)
+            }
+
+            Button(action: { presentationMode.wrappedValue.dismiss() }) {
+                Image(systemName: "xmark.circle.fill")
+                    .font(.system(size: 28))
+                    .foregroundColor(.white.opacity(0.8))
+            }
+            .padding(16)
+        }
+        .task {
+            await viewModel.load()
+        }
+    }
+
+    // MARK: - Components
+
+    private var heroImage: some View {
+        CachedImage(url: URL(string: event.photographs?.first ?? "")) { image in
+            image
+                .resizable()
+                .aspectRatio(contentMode: .fill)
+        } placeholder: {
+            Rectangle()
+                .fill(Color(red: 167/255, green: 167/255, blue: 167/255))
+        }
+        .frame(height: 240)
+        .frame(maxWidth: .infinity)
+        .clipped()
+    }
+
+    private var priceText: String {
+        event.ticketPrice.displayText
+    }
+
+    private func detailRow(icon: String, text: String) -> some View {
+        HStack(alignment: .center, spacing: 6) {
+            Image(systemName: icon)
+                .font(.system(size: 14))
+                .foregroundColor(.white)
+
+            Text(text)
+                .font(.system(size: 14))
+                .foregroundColor(.white)
+        }
+    }
+}
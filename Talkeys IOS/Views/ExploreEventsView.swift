@@ -1,16 +1,18 @@
 import SwiftUI
+import Combine
 import Foundation
 
 // MARK: - Explore Events View
 struct ExploreEventsView: View {
     @StateObject private var eventRepository = EventRepository.shared
-    @StateObject private var authViewModel = AuthViewModel()
+    @ObservedObject private var authViewModel = AppContainer.shared.authViewModel
     @State private var groupedEvents: [String: [EventResponse]] = [:]
     @State private var showLiveEvents = true
     @State private var scrollOffset: CGFloat = 0
     @State private var lastScrollOffset: CGFloat = 0
     @State private var isHeaderVisible = true
     @State private var dragOffset: CGFloat = 0
+    @State private var selectedEvent: EventResponse?
     
     var body: some View {
         NavigationView {
@@ -55,6 +57,15 @@ struct ExploreEventsView: View {
             }
             .navigationBarHidden(true)
         }
+        .sheet(item: $selectedEvent) { event in
+            // Renders from the list snapshot; the detail was usually preloaded on press-down
+            EventDetailView(event: event)
+        }
+        // The list also changes when the local store publishes (launch, background refresh).
+        // `$events` fires before the new value is set, so regroup on the next main-queue turn.
+        .onReceive(eventRepository.$events.dropFirst().receive(on: DispatchQueue.main)) { _ in
+            updateGroupedEvents()
+        }
         .onAppear {
             loadEvents()
             // Ensure user data is loaded for TopBar
@@ -166,7 +177,8 @@ struct ExploreEventsView: View {
                 
                 // Horizontal Scrolling Events
                 ScrollView(.horizontal, showsIndicators: false) {
-                    HStack(spacing: 12) {
+                    // Lazy so each card appears (and preloads its detail) only when scrolled into view
+                    LazyHStack(spacing: 12) {
                         ForEach(events.indices, id: \.self) { index in
                             let event = events[index]
                             
@@ -517,8 +529,7 @@ struct ExploreEventsView: View {
         }
         
         print("Event clicked: \(event.name), ID: \(eventId)")
-        // TODO: Navigate to event detail view
-        // You can implement navigation here
+        selectedEvent = event
     }
     
     // MARK: - Scroll Handling
@@ -586,7 +597,8 @@ struct AnimatedCategorySectionView: View {
             
             // Horizontal Scrolling Events with Rotation Animation
             ScrollView(.horizontal, showsIndicators: false) {
-                HStack(spacing: 12) {
+                // Lazy so each card appears (and preloads its detail) only when scrolled into view
+                LazyHStack(spacing: 12) {
                     ForEach(events.indices, id: \.self) { index in
                         let event = events[index]
                         
@@ -0,0 +1,62 @@
+//
+//  AppContainerTests.swift
+//  Talkeys IOSTests
+//
+
+import Testing
+@testable import Talkeys_IOS
+
+struct AppContainerTests {
+
+    @Test func sharedGraphIsBuiltOncePerContainer() async throws {
+        let container = AppContainer()
+
+        let first = container.authRepository
+        let second = container.authRepository
+        _ = container.apiClient
+        _ = container.tokenStorage
+
+        #expect(first === second)
+        #expect(container.instanceCount(of: "ApiClient") == 1)
+        #expect(container.instanceCount(of: "AuthRepository") == 1)
+        #expect(container.instanceCount(of: "IOSTokenStorage") == 1)
+        #expect(container.instanceCount(of: "IOSGoogleSignInProvider") == 1)
+    }
+
+    @Test func definitionsAreTimedWithSelfTimeExcludingDependencies() async throws {
+        let container = AppContainer()
+        _ = container.userProfileStore
+
+        let store = try #require(container.timing(of: "UserProfileStore"))
+        let database = try #require(container.timing(of: "DatabaseProvider"))
+        #expect(store.totalTime >= database.totalTime)
+        #expect(store.selfTime <= store.totalTime - database.totalTime + 0.001)
+        #expect(container.timingReport().contains("DatabaseProvider"))
+        #expect(container.timing(of: "ApiClient") == nil)
+    }
+
+    @Test func prewarmBuildsDefinitionsOnceInBackground() async throws {
+        let container = AppContainer()
+
+        await withCheckedContinuation { continuation in
+            container.prewarm([.databaseProvider, .userProfileStore, .databaseProvider]) {
+                continuation.resume()
+            }
+        }
+
+        #expect(container.instanceCount(of: "DatabaseProvider") == 1)
+        #expect(container.instanceCount(of: "UserProfileStore") == 1)
+        #expect(container.timing(of: "DatabaseProvider")?.onMainThread == false)
+    }
+
+    @MainActor
+    @Test func screensShareOneAuthViewModel() async throws {
+        let container = AppContainer()
+
+        let landingViewModel = container.authViewModel
+        let exploreViewModel = container.authViewModel
+
+        #expect(landingViewModel === exploreViewModel)
+        #expect(container.instanceCount(of: "AuthViewModel") == 1)
+    }
+}
@@ -0,0 +1,39 @@
+//
+//  AuthDispatchTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+@testable import Talkeys_IOS
+
+struct AuthDispatchTests {
+
+    @MainActor
+    @Test func ioWorkLeavesMainAndTraceCountsHops() async throws {
+        let metrics = AuthFlowMetrics()
+        let trace = AuthFlowTrace("test")
+
+        let ranOnMain = await AuthDispatch.io { pthread_main_np() != 0 }
+        #expect(!ranOnMain)
+
+        await Task.detached { trace.mark("background") }.value
+        trace.mark("mainState")
+        trace.finish(metrics)
+
+        #expect(trace.steps.map(\.name) == ["start", "background", "mainState", "finish"])
+        #expect(trace.hops == 2)
+        #expect(trace.mainHops == 1)
+
+        let summary = try #require(metrics.summary(for: "test"))
+        #expect(summary.runs == 1)
+        #expect(summary.totalMainHops == 1)
+    }
+
+    @Test func throwingIOWorkPropagatesErrors() async throws {
+        struct Failure: Error {}
+        await #expect(throws: Failure.self) {
+            try await AuthDispatch.io { () throws -> Int in throw Failure() }
+        }
+    }
+}
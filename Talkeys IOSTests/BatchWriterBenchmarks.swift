@@ -0,0 +1,49 @@
+//
+//  BatchWriterBenchmarks.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+import sharedKit
+@testable import Talkeys_IOS
+
+/// Rows/sec for per-row inserts vs. one transactional batch. Run with RUN_BENCHMARKS=1 in the test scheme.
+@Suite(.enabled(if: ProcessInfo.processInfo.environment["RUN_BENCHMARKS"] != nil))
+struct BatchWriterBenchmarks {
+
+    /// File-backed so every implicit per-row transaction pays its journal sync, as on device
+    private func makeProvider() -> DatabaseProvider {
+        let path = FileManager.default.temporaryDirectory.appendingPathComponent("bench-\(UUID().uuidString).db").path
+        return DatabaseProvider(path: path)
+    }
+
+    private func rowsPerSecond(_ rows: Int, _ block: () -> Void) -> Double {
+        let start = CFAbsoluteTimeGetCurrent()
+        block()
+        return Double(rows) / (CFAbsoluteTimeGetCurrent() - start)
+    }
+
+    @Test(arguments: [1_000, 10_000])
+    func perRowVersusBatch(rowCount: Int) async throws {
+        let users = (0..<rowCount).map { AppUser(id: "u\($0)", name: "User \($0)", email: "u\($0)@talkeys.xyz", createdAt: "2025-01-01") }
+
+        let perRowQueries = makeProvider().userQueries
+        let perRow = rowsPerSecond(rowCount) {
+            for user in users {
+                perRowQueries.insertUser(id: user.id, name: user.name, email: user.email, profilePicture: user.profilePicture, createdAt: user.createdAt ?? "2025-01-01")
+            }
+        }
+
+        let batchQueries = makeProvider().userQueries
+        let batch = rowsPerSecond(rowCount) { batchQueries.upsert(users) }
+
+        let events = (0..<rowCount).map { EventResponse.fixture(id: "e\($0)", name: "Event \($0)") }
+        let eventQueries = makeProvider().eventQueries
+        let eventBatch = rowsPerSecond(rowCount) { eventQueries.upsert(events) }
+
+        print("📦 \(rowCount) rows — per-row: \(Int(perRow)) rows/s, batched users: \(Int(batch)) rows/s, batched events: \(Int(eventBatch)) rows/s")
+        #expect(batchQueries.selectAll().executeAsList().count == rowCount)
+        #expect(batch > perRow)
+    }
+}
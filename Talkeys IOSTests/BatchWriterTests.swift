@@ -0,0 +1,31 @@
+//
+//  BatchWriterTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+import sharedKit
+@testable import Talkeys_IOS
+
+struct BatchWriterTests {
+
+    @Test func bulkUpsertInsertsAndUpdatesInOneTransaction() async throws {
+        let provider = DatabaseProvider(path: ":memory:")
+        let queries = provider.userQueries
+
+        queries.upsert((0..<50).map { AppUser(id: "u\($0)", name: "User \($0)", email: "u\($0)@talkeys.xyz", createdAt: "2025-01-01") })
+        queries.upsert([AppUser(id: "u7", name: "Renamed", email: "u7@talkeys.xyz", createdAt: "2025-06-01")])
+
+        #expect(queries.selectAll().executeAsList().count == 50)
+        let updated = try #require(queries.selectAppUser(id: "u7"))
+        #expect(updated.name == "Renamed")
+        #expect(updated.createdAt == "2025-01-01")
+        #expect(provider.driver.currentTransaction() == nil)
+
+        // A repeated id within one batch updates the row it just inserted
+        queries.upsert([AppUser(id: "u99", name: "First", email: "u99@talkeys.xyz"), AppUser(id: "u99", name: "Second", email: "u99@talkeys.xyz")])
+        #expect(queries.selectAll().executeAsList().count == 51)
+        #expect(queries.selectAppUser(id: "u99")?.name == "Second")
+    }
+}
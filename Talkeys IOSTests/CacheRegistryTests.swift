@@ -0,0 +1,99 @@
+//
+//  CacheRegistryTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+@testable import Talkeys_IOS
+
+struct CacheRegistryTests {
+
+    private func makeCache(_ name: String, priority: CachePriority, limit: Int = 1_000, registry: CacheRegistry) -> CostCache<Int, String> {
+        CostCache(name: name, priority: priority, limitBytes: limit, registry: registry) { _, value in value.count }
+    }
+
+    @Test func cacheEvictsLeastRecentlyUsedPastItsLimit() {
+        let registry = CacheRegistry(budgetBytes: 10_000)
+        let cache = makeCache("strings", priority: .low, limit: 30, registry: registry)
+
+        cache.insert(String(repeating: "a", count: 10), for: 1)
+        cache.insert(String(repeating: "b", count: 10), for: 2)
+        cache.insert(String(repeating: "c", count: 10), for: 3)
+        _ = cache.value(for: 1)
+        cache.insert(String(repeating: "d", count: 10), for: 4)
+
+        #expect(cache.residentBytes == 30)
+        #expect(cache.value(for: 2) == nil)
+        #expect(cache.value(for: 1) != nil)
+        #expect(cache.value(for: 4) != nil)
+    }
+
+    @Test func replacingAndRemovingKeepRecencyOrder() {
+        let registry = CacheRegistry(budgetBytes: 10_000)
+        let cache = makeCache("strings", priority: .low, limit: 30, registry: registry)
+
+        cache.insert(String(repeating: "a", count: 10), for: 1)
+        cache.insert(String(repeating: "b", count: 10), for: 2)
+        cache.insert(String(repeating: "c", count: 10), for: 3)
+        // Replacing 1 makes it the most recent; removing 3 leaves 2 as the oldest
+        cache.insert(String(repeating: "A", count: 10), for: 1)
+        cache.removeValue(for: 3)
+        cache.insert(String(repeating: "d", count: 10), for: 4)
+        cache.insert(String(repeating: "e", count: 10), for: 5)
+
+        #expect(cache.residentBytes == 30)
+        #expect(cache.entryCount == 3)
+        #expect(cache.value(for: 2) == nil)
+        #expect(cache.value(for: 1) == String(repeating: "A", count: 10))
+
+        cache.removeAll()
+        #expect(cache.entryCount == 0)
+        cache.insert("f", for: 6)
+        #expect(cache.value(for: 6) == "f")
+    }
+
+    @Test func globalBudgetShedsLowPriorityFirst() {
+        let registry = CacheRegistry(budgetBytes: 100)
+        let low = makeCache("low", priority: .low, registry: registry)
+        let high = makeCache("high", priority: .high, registry: registry)
+
+        low.insert(String(repeating: "l", count: 60), for: 1)
+        high.insert(String(repeating: "h", count: 60), for: 1)
+
+        #expect(registry.residentBytes <= 100)
+        #expect(low.entryCount == 0)
+        #expect(high.entryCount == 1)
+    }
+
+    @Test func memoryWarningShedsByPriority() {
+        let registry = CacheRegistry(budgetBytes: 10_000)
+        let low = makeCache("low", priority: .low, registry: registry)
+        let medium = makeCache("medium", priority: .medium, registry: registry)
+        let high = makeCache("high", priority: .high, registry: registry)
+        for key in 0..<4 {
+            low.insert(String(repeating: "l", count: 10), for: key)
+            medium.insert(String(repeating: "m", count: 10), for: key)
+            high.insert(String(repeating: "h", count: 10), for: key)
+        }
+
+        registry.shed(.warning)
+        #expect(low.residentBytes == 0)
+        #expect(medium.residentBytes == 20)
+        #expect(high.residentBytes == 40)
+
+        registry.shed(.critical)
+        #expect(medium.residentBytes == 0)
+        #expect(high.residentBytes == 20)
+    }
+
+    @Test func reportListsResidentBytesPerCache() {
+        let registry = CacheRegistry(budgetBytes: 10_000)
+        let cache = makeCache("formattedDates", priority: .low, registry: registry)
+        cache.insert("12 Oct 2025", for: 1)
+
+        let report = registry.report()
+        #expect(report.contains("formattedDates [low]"))
+        #expect(report.contains("1 entries"))
+    }
+}
@@ -0,0 +1,35 @@
+//
+//  EventDecodingBenchmarks.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+@testable import Talkeys_IOS
+
+/// Events/sec for the old strict page decode vs. `EventDecoding`. Run with RUN_BENCHMARKS=1 in the test scheme.
+@Suite(.enabled(if: ProcessInfo.processInfo.environment["RUN_BENCHMARKS"] != nil))
+struct EventDecodingBenchmarks {
+
+    @Test(arguments: [500, 5_000])
+    func strictVersusLossyDecode(eventCount: Int) async throws {
+        let events = try (0..<eventCount).map { try eventJSON(.fixture(id: "e\($0)", name: "Event \($0)", description: "Description \($0)")) }
+        let payload = eventListPayload(events)
+
+        var start = CFAbsoluteTimeGetCurrent()
+        let strict = try JSONDecoder().decode(EventListResponse.self, from: payload)
+        let strictRate = Double(eventCount) / (CFAbsoluteTimeGetCurrent() - start)
+
+        start = CFAbsoluteTimeGetCurrent()
+        let lossy = try EventDecoding.decodeList(payload)
+        let lossyRate = Double(eventCount) / (CFAbsoluteTimeGetCurrent() - start)
+
+        // One bad event used to cost the whole page
+        let withBadEvent = eventListPayload(events + [#"{"_id":"broken"}"#])
+        #expect(throws: (any Error).self) { try JSONDecoder().decode(EventListResponse.self, from: withBadEvent) }
+        #expect(try EventDecoding.decodeList(withBadEvent).events.count == eventCount)
+
+        print("🧩 \(eventCount) events — strict: \(Int(strictRate)) events/s, lossy: \(Int(lossyRate)) events/s")
+        #expect(strict.data.events.count == lossy.events.count)
+    }
+}
@@ -0,0 +1,59 @@
+//
+//  EventDecodingTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+@testable import Talkeys_IOS
+
+/// `getEvents` body with the given event objects spliced in as raw JSON
+func eventListPayload(_ events: [String]) -> Data {
+    Data(#"{"status":"success","data":{"events":[\#(events.joined(separator: ","))],"pagination":{"total":\#(events.count),"page":1,"pages":1,"limit":\#(events.count)}}}"#.utf8)
+}
+
+func eventJSON(_ event: EventResponse) throws -> String {
+    String(decoding: try JSONEncoder().encode(event), as: UTF8.self)
+}
+
+struct EventDecodingTests {
+
+    @Test func malformedEventsAreSkippedNotFatal() async throws {
+        let good = try eventJSON(.fixture(id: "e1"))
+        let nullPrice = good.replacingOccurrences(of: #""_id":"e1""#, with: #""_id":"e2""#)
+            .replacingOccurrences(of: #""ticketPrice":0"#, with: #""ticketPrice":null"#)
+        let stringSeats = good.replacingOccurrences(of: #""_id":"e1""#, with: #""_id":"e3""#)
+            .replacingOccurrences(of: #""totalSeats":100"#, with: #""totalSeats":"100""#)
+        let missingName = #"{"_id":"e4","category":"Music"}"#
+
+        let page = try EventDecoding.decodeList(eventListPayload([good, nullPrice, stringSeats, missingName]))
+
+        #expect(page.events.map(\.id) == ["e1", "e2", "e3"])
+        #expect(page.skipped == 1)
+        #expect(page.events[1].ticketPrice == .unknown)
+        #expect(page.events[1].ticketPrice.displayText != TicketPrice.int(0).displayText)
+        #expect(page.events[2].totalSeats.intValue == 100)
+        #expect(page.pagination?.total == 4)
+    }
+
+    @Test func nullPriceAndSeatsSurviveTheStoreRoundTrip() async throws {
+        let json = try eventJSON(.fixture(id: "e5"))
+            .replacingOccurrences(of: #""ticketPrice":0"#, with: #""ticketPrice":null"#)
+            .replacingOccurrences(of: #""totalSeats":100"#, with: #""totalSeats":null"#)
+
+        let decoded = try EventDecoding.decodeEvent(Data(json.utf8))
+        let reencoded = try EventDecoding.decodeEvent(Data(try eventJSON(decoded).utf8))
+
+        #expect(reencoded.ticketPrice == .unknown)
+        #expect(reencoded.totalSeats == .unknown)
+        #expect(reencoded.totalSeats.intValue == nil)
+    }
+
+    @Test func singleEventDecodesBareOrWrapped() async throws {
+        let json = try eventJSON(.fixture(id: "e9", name: "Jazz Evening"))
+
+        #expect(try EventDecoding.decodeEvent(Data(json.utf8)).name == "Jazz Evening")
+        #expect(try EventDecoding.decodeEvent(Data(#"{"data":\#(json)}"#.utf8)).id == "e9")
+        #expect(throws: (any Error).self) { try EventDecoding.decodeEvent(Data("{}".utf8)) }
+    }
+}
@@ -0,0 +1,221 @@
+//
+//  EventDetailLoaderTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+@testable import Talkeys_IOS
+
+struct EventDetailLoaderTests {
+
+    /// Counts fetches and can hold them open so concurrent callers overlap
+    private final class FetchCounter {
+        private let lock = NSLock()
+        private var count = 0
+
+        var calls: Int {
+            lock.lock()
+            defer { lock.unlock() }
+            return count
+        }
+
+        func fetch(_ id: String) async throws -> EventResponse {
+            lock.lock()
+            count += 1
+            lock.unlock()
+            try await Task.sleep(nanoseconds: 50_000_000)
+            return .fixture(id: id, name: "Detail", description: "Full description")
+        }
+    }
+
+    private final class Clock {
+        var now = Date(timeIntervalSince1970: 0)
+    }
+
+    @Test func snapshotRendersFromListUntilDetailArrives() async throws {
+        let counter = FetchCounter()
+        let loader = EventDetailLoader(registry: CacheRegistry(), images: nil, fetch: counter.fetch)
+        let listEvent = EventResponse.fixture(id: "e1", name: "List")
+
+        #expect(loader.snapshot(for: listEvent).name == "List")
+
+        let detail = try await loader.detail(for: "e1")
+        #expect(detail.eventDescription == "Full description")
+        #expect(loader.snapshot(for: listEvent).name == "Detail")
+    }
+
+    @Test func concurrentRequestsShareOneFetch() async throws {
+        let counter = FetchCounter()
+        let loader = EventDetailLoader(registry: CacheRegistry(), images: nil, fetch: counter.fetch)
+
+        async let first = loader.detail(for: "e1")
+        async let second = loader.detail(for: "e1")
+        _ = try await (first, second)
+        _ = try await loader.detail(for: "e1")
+
+        #expect(counter.calls == 1)
+    }
+
+    @Test func detailsExpireAfterTTL() async throws {
+        let counter = FetchCounter()
+        let clock = Clock()
+        let loader = EventDetailLoader(ttl: 60, registry: CacheRegistry(), images: nil, now: { clock.now }, fetch: counter.fetch)
+
+        _ = try await loader.detail(for: "e1")
+        clock.now += 30
+        #expect(loader.cachedDetail(for: "e1") != nil)
+
+        clock.now += 31
+        #expect(loader.cachedDetail(for: "e1") == nil)
+        _ = try await loader.detail(for: "e1")
+        #expect(counter.calls == 2)
+    }
+
+    @Test func preloadWarmsTheCache() async throws {
+        let counter = FetchCounter()
+        let loader = EventDetailLoader(registry: CacheRegistry(), images: nil, fetch: counter.fetch)
+
+        loader.preload(.fixture(id: "e1"))
+        for _ in 0..<50 where loader.cachedDetail(for: "e1") == nil {
+            try await Task.sleep(nanoseconds: 10_000_000)
+        }
+
+        #expect(loader.cachedDetail(for: "e1") != nil)
+        _ = try await loader.detail(for: "e1")
+        #expect(counter.calls == 1)
+    }
+
+    // MARK: - Batch Lookup
+
+    /// Tracks how many per-id fetches run at once
+    private final class ConcurrencyProbe {
+        private let lock = NSLock()
+        private var running = 0
+        private(set) var peak = 0
+        private(set) var calls = 0
+
+        func fetch(_ id: String) async throws -> EventResponse {
+            lock.lock()
+            running += 1
+            calls += 1
+            peak = max(peak, running)
+            lock.unlock()
+            try await Task.sleep(nanoseconds: 30_000_000)
+            lock.lock()
+            running -= 1
+            lock.unlock()
+            return .fixture(id: id)
+        }
+    }
+
+    private func collect(_ stream: AsyncStream<EventDetailLoader.Lookup>) async -> [EventDetailLoader.Lookup] {
+        var lookups: [EventDetailLoader.Lookup] = []
+        for await lookup in stream {
+            lookups.append(lookup)
+        }
+        return lookups
+    }
+
+    @Test func batchEndpointResolvesIdsInOneRequest() async throws {
+        let probe = ConcurrencyProbe()
+        var batches: [[String]] = []
+        let loader = EventDetailLoader(registry: CacheRegistry(), images: nil, fetch: probe.fetch, fetchBatch: { ids in
+            batches.append(ids)
+            return ids.map { .fixture(id: $0) }
+        })
+        _ = try await loader.detail(for: "cached")
+        let cachedFetches = probe.calls
+
+        let lookups = await collect(loader.details(for: ["cached", "a", "b", "a", "c"]))
+
+        #expect(lookups.map(\.eventId) == ["cached", "a", "b", "c"])
+        #expect(batches == [["a", "b", "c"]])
+        #expect(probe.calls == cachedFetches)
+        #expect(loader.batchSupport == .supported)
+    }
+
+    @Test func missingBatchEndpointFallsBackToBoundedFanOut() async throws {
+        let probe = ConcurrencyProbe()
+        let loader = EventDetailLoader(registry: CacheRegistry(), images: nil, fetch: probe.fetch, fetchBatch: { _ in
+            throw APIError.serverError(404)
+        })
+        let ids = (0..<10).map { "e\($0)" }
+
+        let lookups = await collect(loader.details(for: ids, maxConcurrent: 3))
+
+        #expect(Set(lookups.map(\.eventId)) == Set(ids))
+        #expect(lookups.allSatisfy { (try? $0.result.get()) != nil })
+        #expect(probe.calls == 10)
+        #expect(probe.peak <= 3)
+        #expect(loader.batchSupport == .unsupported)
+    }
+
+    // MARK: - Cancellation
+
+    /// Fetches that hang until cancelled, recording which ones started and which were cancelled
+    private actor HangingFetch {
+        private(set) var started: [String] = []
+        private(set) var cancelled: [String] = []
+
+        func fetch(_ id: String) async throws -> EventResponse {
+            started.append(id)
+            do {
+                try await Task.sleep(nanoseconds: 5_000_000_000)
+            } catch {
+                cancelled.append(id)
+                throw error
+            }
+            return .fixture(id: id)
+        }
+
+        func waitFor(started count: Int) async -> Bool {
+            await poll { started.count >= count }
+        }
+
+        func waitFor(cancelled count: Int) async -> Bool {
+            await poll { cancelled.count >= count }
+        }
+
+        /// Polls until `condition` holds; false if it never does
+        private func poll(_ condition: () -> Bool) async -> Bool {
+            for _ in 0..<200 where !condition() {
+                try? await Task.sleep(nanoseconds: 10_000_000)
+            }
+            return condition()
+        }
+    }
+
+    @Test func cancellingTheOnlyCallerCancelsTheFetch() async throws {
+        let hanging = HangingFetch()
+        let loader = EventDetailLoader(registry: CacheRegistry(), images: nil, fetch: { try await hanging.fetch($0) })
+
+        let caller = Task { try await loader.detail(for: "e1") }
+        #expect(await hanging.waitFor(started: 1))
+        caller.cancel()
+
+        await #expect(throws: CancellationError.self) {
+            try await caller.value
+        }
+        #expect(await hanging.waitFor(cancelled: 1))
+        #expect(await hanging.cancelled == ["e1"])
+        #expect(loader.cachedDetail(for: "e1") == nil)
+    }
+
+    @Test func cancellingTheStreamStopsTheFanOut() async throws {
+        let hanging = HangingFetch()
+        let loader = EventDetailLoader(registry: CacheRegistry(), images: nil, fetch: { try await hanging.fetch($0) }, fetchBatch: nil)
+        let ids = (0..<10).map { "e\($0)" }
+
+        let consumer = Task {
+            for await _ in loader.details(for: ids, maxConcurrent: 2) {}
+        }
+        #expect(await hanging.waitFor(started: 2))
+        consumer.cancel()
+        await consumer.value
+
+        #expect(await hanging.waitFor(cancelled: 2))
+        // The two cancelled lookups must not have made room for more requests
+        #expect(await hanging.started.count == 2)
+    }
+}
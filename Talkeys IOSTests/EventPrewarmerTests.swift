@@ -0,0 +1,89 @@
+//
+//  EventPrewarmerTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+import UIKit
+@testable import Talkeys_IOS
+
+struct EventPrewarmerTests {
+
+    private func event(id: String, isLive: Bool) -> EventResponse {
+        let base = EventResponse.fixture(id: id, isLive: isLive)
+        return EventResponse(
+            _id: base._id, name: base.name, category: base.category, ticketPrice: base.ticketPrice, mode: base.mode,
+            location: base.location, duration: base.duration, slots: base.slots, visibility: base.visibility,
+            startDate: base.startDate, startTime: base.startTime, endRegistrationDate: nil, totalSeats: base.totalSeats,
+            eventDescription: nil, photographs: ["https://example.com/\(id).jpg"], prizes: nil, isTeamEvent: false,
+            isPaid: false, isLive: isLive, organizerName: nil, organizerEmail: nil, organizerContact: nil
+        )
+    }
+
+    @Test func persistsEventsAndDecodesLiveImagesFirst() async throws {
+        var persisted: [EventResponse] = []
+        var loaded: [String] = []
+        let prewarmer = EventPrewarmer(
+            imageCount: 3,
+            fetchEvents: {
+                [event(id: "past1", isLive: false), event(id: "live1", isLive: true), event(id: "past2", isLive: false),
+                 event(id: "live2", isLive: true), event(id: "live3", isLive: true)]
+            },
+            persist: { persisted = $0 },
+            loadImage: { url in
+                loaded.append(url.deletingPathExtension().lastPathComponent)
+                return UIImage()
+            }
+        )
+
+        let report = await prewarmer.run()
+
+        #expect(persisted.count == 5)
+        // Live first, each group in API order
+        #expect(loaded == ["live1", "live2", "live3"])
+        #expect(report.fetched == 5)
+        #expect(report.imagesDecoded == 3)
+        #expect(report.completed)
+    }
+
+    @Test func deadlineStopsImageDecoding() async throws {
+        var loads = 0
+        var clock: TimeInterval = 0
+        let prewarmer = EventPrewarmer(
+            imageCount: 5,
+            deadline: 10,
+            now: { clock },
+            fetchEvents: { (0..<5).map { event(id: "e\($0)", isLive: true) } },
+            persist: { _ in },
+            loadImage: { _ in
+                loads += 1
+                clock += 4
+                return UIImage()
+            }
+        )
+
+        let report = await prewarmer.run()
+
+        // Loads start at 0s, 4s and 8s; at 12s the deadline has passed
+        #expect(report.fetched == 5)
+        #expect(loads == 3)
+        #expect(report.imagesDecoded == 3)
+        #expect(!report.completed)
+    }
+
+    @Test func fetchFailurePersistsNothing() async throws {
+        struct Offline: Error {}
+        var persisted = false
+        let prewarmer = EventPrewarmer(
+            fetchEvents: { throw Offline() },
+            persist: { _ in persisted = true },
+            loadImage: { _ in nil }
+        )
+
+        let report = await prewarmer.run()
+
+        #expect(!persisted)
+        #expect(report.fetched == 0)
+    }
+}
@@ -0,0 +1,64 @@
+//
+//  EventQueriesTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+@testable import Talkeys_IOS
+
+extension EventResponse {
+    /// Minimal event for database tests
+    static func fixture(id: String, name: String = "Event", category: String = "Music", isLive: Bool = true, startDate: String = "2025-01-01", location: String? = "Patiala", description: String? = nil, organizer: String? = nil) -> EventResponse {
+        EventResponse(
+            _id: id, name: name, category: category, ticketPrice: .int(0), mode: "offline",
+            location: location, duration: "2h", slots: 1, visibility: "public",
+            startDate: startDate, startTime: "18:00", endRegistrationDate: nil, totalSeats: .int(100),
+            eventDescription: description, photographs: nil, prizes: nil, isTeamEvent: false,
+            isPaid: false, isLive: isLive, organizerName: organizer, organizerEmail: nil, organizerContact: nil
+        )
+    }
+}
+
+struct EventQueriesTests {
+
+    @Test func filtersRunAgainstLocalTable() async throws {
+        let queries = DatabaseProvider(path: ":memory:").eventQueries
+        queries.replaceAll(with: [
+            .fixture(id: "e1", category: "Music", isLive: true, startDate: "2025-03-01"),
+            .fixture(id: "e2", category: "music", isLive: true, startDate: "2025-02-01"),
+            .fixture(id: "e3", category: "Tech", isLive: false, startDate: "2024-12-01")
+        ])
+
+        #expect(queries.count() == 3)
+        #expect(queries.selectAll().map(\.id) == ["e1", "e2", "e3"])
+        #expect(queries.selectLive().map(\.id) == ["e2", "e1"])
+        #expect(queries.selectPast().map(\.id) == ["e3"])
+        #expect(Set(queries.selectByCategory("MUSIC").map(\.id)) == ["e1", "e2"])
+        #expect(queries.selectById("e3")?.category == "Tech")
+
+        queries.replaceAll(with: [.fixture(id: "e4")])
+        #expect(queries.selectAll().map(\.id) == ["e4"])
+    }
+
+    @Test func searchIsRankedAndPaged() async throws {
+        let queries = DatabaseProvider(path: ":memory:").eventQueries
+        queries.replaceAll(with: [
+            .fixture(id: "e1", name: "Open Mic Night", description: "Poetry and music"),
+            .fixture(id: "e2", name: "Music Fest", location: "Chandigarh"),
+            .fixture(id: "e3", name: "Hackathon", category: "Tech", organizer: "Music Club")
+        ])
+
+        #expect(queries.search("music").first?.id == "e2")
+        #expect(Set(queries.search("mus").map(\.id)) == ["e1", "e2", "e3"])
+        #expect(queries.search("music", limit: 1, offset: 1).count == 1)
+        #expect(queries.search("chandigarh music").map(\.id) == ["e2"])
+        #expect(queries.search("\"*)(").isEmpty)
+
+        // The index follows upserts and deletes
+        queries.upsert([.fixture(id: "e2", name: "Jazz Evening")])
+        #expect(!queries.search("fest").contains { $0.id == "e2" })
+        queries.deleteAll()
+        #expect(queries.search("music").isEmpty)
+    }
+}
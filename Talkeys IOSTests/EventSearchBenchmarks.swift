@@ -0,0 +1,50 @@
+//
+//  EventSearchBenchmarks.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+@testable import Talkeys_IOS
+
+/// FTS5 search vs. the in-memory substring scan. Run with RUN_BENCHMARKS=1 in the test scheme.
+@Suite(.enabled(if: ProcessInfo.processInfo.environment["RUN_BENCHMARKS"] != nil))
+struct EventSearchBenchmarks {
+
+    private static let words = ["music", "tech", "poetry", "comedy", "dance", "startup", "workshop", "film", "gaming", "quiz"]
+    private static let cities = ["Patiala", "Chandigarh", "Delhi", "Mumbai", "Pune"]
+
+    private func makeEvents(_ count: Int) -> [EventResponse] {
+        (0..<count).map { index in
+            let word = Self.words[index % Self.words.count]
+            return .fixture(
+                id: "event-\(index)",
+                name: "\(word.capitalized) \(Self.words[(index / 7) % Self.words.count]) \(index)",
+                category: Self.words[(index / 3) % Self.words.count],
+                location: Self.cities[index % Self.cities.count],
+                description: "An evening of \(word) with friends and \(Self.words[(index / 11) % Self.words.count])",
+                organizer: "\(Self.cities[(index / 5) % Self.cities.count]) Club"
+            )
+        }
+    }
+
+    private func measure(_ iterations: Int, _ block: () -> Void) -> Double {
+        let start = CFAbsoluteTimeGetCurrent()
+        for _ in 0..<iterations { block() }
+        return (CFAbsoluteTimeGetCurrent() - start) / Double(iterations) * 1000
+    }
+
+    @Test(arguments: [1_000, 10_000, 100_000])
+    func ftsVersusScan(eventCount: Int) async throws {
+        let events = makeEvents(eventCount)
+        let queries = DatabaseProvider(path: ":memory:").eventQueries
+        queries.replaceAll(with: events)
+
+        let query = "poetry delhi"
+        let scanMs = measure(10) { _ = EventRepository.scan(events, for: "poetry") }
+        let ftsMs = measure(10) { _ = queries.search(query, limit: 50) }
+
+        print("🔎 \(eventCount) events — scan: \(String(format: "%.2f", scanMs)) ms, FTS5 page: \(String(format: "%.2f", ftsMs)) ms")
+        #expect(!queries.search(query, limit: 50).isEmpty)
+    }
+}
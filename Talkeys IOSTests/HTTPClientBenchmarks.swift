@@ -0,0 +1,48 @@
+//
+//  HTTPClientBenchmarks.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+@testable import Talkeys_IOS
+
+/// Requests/sec against a local mock server: unpooled baseline vs. the tuned profile,
+/// with and without a cacheable response. Run with RUN_BENCHMARKS=1 in the test scheme.
+@Suite(.enabled(if: ProcessInfo.processInfo.environment["RUN_BENCHMARKS"] != nil))
+struct HTTPClientBenchmarks {
+
+    private let requestCount = 200
+
+    /// ~100 KB, about the size of a `getEvents` page
+    private let body = Data(("{\"events\":[" + Array(repeating: "{\"name\":\"Open Mic Night\",\"location\":\"Patiala\"}", count: 2_000).joined(separator: ",") + "]}").utf8)
+
+    private func measure(_ base: HTTPClientProfile, cacheable: Bool) async throws -> (perSecond: Double, connections: Int, served: Int) {
+        let server = try MockHTTPServer(body: body, headers: cacheable ? ["Cache-Control": "max-age=60"] : [:], latency: 0.002)
+        let url = try server.start()
+        defer { server.stop() }
+
+        var profile = base
+        profile.cacheDirectory = FileManager.default.temporaryDirectory.appendingPathComponent("http-bench-\(UUID().uuidString)")
+        let client = HTTPClient(profile: profile)
+
+        let start = CFAbsoluteTimeGetCurrent()
+        for _ in 0..<requestCount {
+            _ = try await client.data(for: URLRequest(url: url), endpoint: .list)
+        }
+        let elapsed = CFAbsoluteTimeGetCurrent() - start
+        return (Double(requestCount) / elapsed, server.connections, server.requests)
+    }
+
+    @Test func unpooledVersusTunedProfile() async throws {
+        let baseline = try await measure(.unpooled, cacheable: false)
+        let tuned = try await measure(.default, cacheable: false)
+        let cached = try await measure(.default, cacheable: true)
+
+        for (label, result) in [("unpooled", baseline), ("tuned", tuned), ("tuned+cache", cached)] {
+            print("🌐 \(label): \(Int(result.perSecond)) req/s, \(result.connections) connections, \(result.served) served by server")
+        }
+        #expect(tuned.connections < baseline.connections)
+        #expect(cached.served < requestCount)
+    }
+}
@@ -0,0 +1,57 @@
+//
+//  HTTPClientTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+@testable import Talkeys_IOS
+
+struct HTTPClientTests {
+
+    private func profile(_ base: HTTPClientProfile = .default) -> HTTPClientProfile {
+        var profile = base
+        profile.cacheDirectory = FileManager.default.temporaryDirectory.appendingPathComponent("http-cache-\(UUID().uuidString)")
+        return profile
+    }
+
+    @Test func profileAppliesTimeoutsAndCaching() async throws {
+        let tuned = HTTPClientProfile.default
+        #expect(tuned.timeout(for: .detail) < tuned.timeout(for: .media))
+        #expect(EndpointClass.auth.cachePolicy == .reloadIgnoringLocalCacheData)
+
+        let configuration = tuned.makeConfiguration()
+        #expect(configuration.urlCache != nil)
+        #expect(configuration.httpMaximumConnectionsPerHost == tuned.maximumConnectionsPerHost)
+        // URLSession negotiates content encoding; a manual header would override it
+        #expect(configuration.httpAdditionalHeaders?["Accept-Encoding"] == nil)
+
+        // Offline requests fail fast instead of waiting out the resource timeout
+        #expect(!configuration.waitsForConnectivity)
+        #expect(configuration.timeoutIntervalForResource >= tuned.timeouts.values.max() ?? 0)
+        #expect(configuration.timeoutIntervalForResource <= 60)
+
+        #expect(HTTPClientProfile.unpooled.makeConfiguration().urlCache == nil)
+        #expect(HTTPClientProfile.unpooled.timeout(for: .list) == NetworkConfig.API.timeoutInterval)
+    }
+
+    @Test func sharedSessionReusesConnections() async throws {
+        let server = try MockHTTPServer(body: Data(#"{"status":"ok"}"#.utf8))
+        let url = try server.start()
+        defer { server.stop() }
+
+        let pooled = HTTPClient(profile: profile())
+        for _ in 0..<10 {
+            _ = try await pooled.data(for: URLRequest(url: url), endpoint: .detail)
+        }
+        #expect(server.requests == 10)
+        #expect(server.connections < 10)
+
+        let connectionsBefore = server.connections
+        let unpooled = HTTPClient(profile: profile(.unpooled))
+        for _ in 0..<5 {
+            _ = try await unpooled.data(for: URLRequest(url: url), endpoint: .detail)
+        }
+        #expect(server.connections - connectionsBefore == 5)
+    }
+}
@@ -0,0 +1,58 @@
+//
+//  HTTPMetricsTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+@testable import Talkeys_IOS
+
+struct HTTPMetricsTests {
+
+    @Test func templatesCollapseIdentifiers() async throws {
+        #expect(HTTPMetrics.template(for: URL(string: "https://api.talkeys.xyz/getEventById/66f0c1a2b3")!) == "getEventById/{id}")
+        #expect(HTTPMetrics.template(for: URL(string: "https://api.talkeys.xyz/getEvents")!) == "getEvents")
+        #expect(HTTPMetrics.template(for: URL(string: "https://api.talkeys.xyz/users/42/events")!) == "users/{id}/events")
+    }
+
+    @Test func clientRecordsPhasesAndBytesPerTemplate() async throws {
+        let server = try MockHTTPServer(body: Data(#"{"status":"ok"}"#.utf8))
+        let url = try server.start()
+        defer { server.stop() }
+
+        let metrics = HTTPMetrics()
+        var profile = HTTPClientProfile.default
+        profile.cacheDirectory = FileManager.default.temporaryDirectory.appendingPathComponent("http-metrics-\(UUID().uuidString)")
+        let client = HTTPClient(profile: profile, metrics: metrics)
+
+        for id in ["a1b2c3d4e5", "f6a7b8c9d0"] {
+            _ = try await client.data(for: URLRequest(url: url.appendingPathComponent("getEventById/\(id)")), endpoint: .detail)
+        }
+
+        let entry = try #require(metrics.snapshot.value["getEventById/{id}"])
+        #expect(entry.requests == 2)
+        #expect(entry.failures == 0)
+        #expect(entry.bytesReceived > 0)
+        #expect(entry.phaseMilliseconds[.wait] != nil)
+    }
+
+    @Test func collectorStopsWaitingWhenMetricsNeverArrive() async throws {
+        let collector = HTTPMetricsCollector()
+        #expect(await collector.taskMetrics(timeout: 0.01) == nil)
+        // Already finished, so a second wait returns at once
+        #expect(await collector.taskMetrics(timeout: 60) == nil)
+    }
+
+    @Test func measureTimesExternalCalls() async throws {
+        let metrics = HTTPMetrics()
+        struct Failure: Error {}
+
+        _ = await metrics.measure(template: "auth/checkExistingAuth") { 1 }
+        _ = try? await metrics.measure(template: "auth/checkExistingAuth") { () throws -> Int in throw Failure() }
+
+        let entry = try #require(metrics.snapshot.value["auth/checkExistingAuth"])
+        #expect(entry.requests == 2)
+        #expect(entry.failures == 1)
+        #expect(metrics.report().contains("auth/checkExistingAuth"))
+    }
+}
@@ -0,0 +1,51 @@
+//
+//  InstrumentedSqlDriverTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+import sharedKit
+@testable import Talkeys_IOS
+
+struct InstrumentedSqlDriverTests {
+
+    @Test func generatedUserQueriesReuseTheirPreparedStatements() async throws {
+        let provider = DatabaseProvider(path: ":memory:", instrumented: true)
+        let metrics = try #require(provider.instrumentation)
+        let queries = provider.userQueries
+
+        queries.upsert([AppUser(id: "u1", name: "Asha", email: "asha@talkeys.xyz", createdAt: "2025-01-01")])
+        metrics.reset()
+        let cacheBefore = try #require(metrics.statementCacheStatistics)
+
+        for _ in 0..<10 {
+            _ = queries.selectById(id: "u1").executeAsOneOrNull()
+        }
+
+        let selectById = try #require(metrics.queryStatistics.values.first { $0.label.contains("WHERE") && $0.label.contains("id") })
+        #expect(selectById.executions == 10)
+        #expect(selectById.rowsReturned == 10)
+        #expect(selectById.latencyBuckets.reduce(0, +) == 10)
+
+        // One generated statement, prepared at most once, then served from the cache
+        let cacheAfter = try #require(metrics.statementCacheStatistics)
+        #expect(cacheAfter.hits - cacheBefore.hits >= 9)
+        #expect(cacheAfter.uncached == cacheBefore.uncached)
+        #expect(metrics.report().contains("10x"))
+    }
+
+    @Test func eventWritesAreCountedPerIdentifier() async throws {
+        let provider = DatabaseProvider(path: ":memory:", instrumented: true)
+        let metrics = try #require(provider.instrumentation)
+
+        provider.eventQueries.upsert((0..<25).map { EventResponse.fixture(id: "e\($0)") })
+        _ = provider.eventQueries.selectLive()
+
+        let upsert = try #require(metrics.queryStatistics.values.first { $0.label.contains("INSERT INTO event") })
+        #expect(upsert.executions == 25)
+        #expect(upsert.rowsChanged >= 25)
+        let live = try #require(metrics.queryStatistics.values.first { $0.label.contains("isLive = 1") })
+        #expect(live.rowsReturned == 25)
+    }
+}
@@ -0,0 +1,142 @@
+//
+//  KotlinBridgeTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+import sharedKit
+@testable import Talkeys_IOS
+
+/// Swift stand-in for a Kotlin Flow: emits each value in turn, waiting for the collector like `collect` does
+private final class FakeFlow: NSObject, Kotlinx_coroutines_coreFlow {
+    private let values: [Any]
+    private(set) var completionError: Error?
+
+    init(_ values: [Any]) {
+        self.values = values
+    }
+
+    func collect(collector: Kotlinx_coroutines_coreFlowCollector, completionHandler: @escaping (Error?) -> Void) {
+        emit(from: 0, to: collector, completionHandler: completionHandler)
+    }
+
+    private func emit(from index: Int, to collector: Kotlinx_coroutines_coreFlowCollector, completionHandler: @escaping (Error?) -> Void) {
+        guard index < values.count else {
+            completionHandler(nil)
+            return
+        }
+        DispatchQueue.global().asyncAfter(deadline: .now() + 0.01) {
+            collector.emit(value: self.values[index]) { error in
+                if let error = error {
+                    self.completionError = error
+                    completionHandler(error)
+                } else {
+                    self.emit(from: index + 1, to: collector, completionHandler: completionHandler)
+                }
+            }
+        }
+    }
+}
+
+/// Swift stand-in for a quiet Kotlin StateFlow: emits its current value, then stays parked like `collect` does
+private final class QuietStateFlow: NSObject, Kotlinx_coroutines_coreStateFlow {
+    let value: Any?
+    private let lock = NSLock()
+    private var collects = 0
+
+    init(_ value: Any) {
+        self.value = value
+    }
+
+    var replayCache: [Any] {
+        [value as Any]
+    }
+
+    var collectCount: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return collects
+    }
+
+    func collect(collector: Kotlinx_coroutines_coreFlowCollector, completionHandler: @escaping (Error?) -> Void) {
+        lock.lock()
+        collects += 1
+        lock.unlock()
+        collector.emit(value: value) { _ in }
+    }
+}
+
+struct KotlinBridgeTests {
+
+    @Test func completionHandlersBecomeAsync() async throws {
+        let value: String = try await KotlinBridge.result { completion in
+            DispatchQueue.global().async { completion("token", nil) }
+        }
+        #expect(value == "token")
+
+        let missing: String? = try await KotlinBridge.optionalResult { completion in completion(nil, nil) }
+        #expect(missing == nil)
+
+        await #expect(throws: KotlinBridge.BridgeError.self) {
+            let _: String = try await KotlinBridge.result { completion in completion(nil, nil) }
+        }
+    }
+
+    @Test func cancellationResumesWithoutWaitingForKotlin() async throws {
+        let task = Task {
+            let _: String = try await KotlinBridge.result { _ in
+                // Never completes, like a hung network call
+            }
+        }
+        task.cancel()
+        await #expect(throws: CancellationError.self) { try await task.value }
+    }
+
+    @Test func flowValuesArriveInOrderAndCancelStopsCollection() async throws {
+        let flow = FakeFlow([1, 2, 3, 4, 5].map { KotlinInt(int: $0) })
+        var received: [Int32] = []
+        for await value in KotlinBridge.stream(flow, of: KotlinInt.self) {
+            received.append(value.int32Value)
+            if received.count == 2 { break }
+        }
+        #expect(received == [1, 2])
+
+        // The collector fails its next emit, ending the producer
+        try await Task.sleep(nanoseconds: 100_000_000)
+        #expect(flow.completionError != nil)
+    }
+
+    @Test func cancelledCallsDontReachKotlin() async throws {
+        final class Calls: @unchecked Sendable {
+            var count = 0
+        }
+        let calls = Calls()
+        let task = Task {
+            withUnsafeCurrentTask { $0?.cancel() }
+            let _: String? = try await KotlinBridge.optionalResult { completion in
+                calls.count += 1
+                completion("late", nil)
+            }
+        }
+        await #expect(throws: CancellationError.self) { try await task.value }
+        #expect(calls.count == 0)
+    }
+
+    @Test func streamsOnAQuietStateFlowShareOneCollection() async throws {
+        let flow = QuietStateFlow(KotlinInt(int: 7))
+
+        for _ in 0..<3 {
+            var first: Int32?
+            for await value in KotlinBridge.stream(flow, of: KotlinInt.self) {
+                first = value.int32Value
+                break
+            }
+            // Every stream starts with the current value, even after the first emission was consumed
+            #expect(first == 7)
+        }
+
+        // Streams ending on a quiet flow would each leave a parked collector; they reuse one instead
+        #expect(flow.collectCount == 1)
+    }
+}
@@ -0,0 +1,84 @@
+//
+//  MigrationRunnerTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Combine
+import Testing
+import sharedKit
+@testable import Talkeys_IOS
+
+struct MigrationRunnerTests {
+
+    @Test func searchBackfillResumesAfterInterruption() async throws {
+        let path = FileManager.default.temporaryDirectory.appendingPathComponent("migration-\(UUID().uuidString).db").path
+        let provider = DatabaseProvider(path: path)
+        provider.eventQueries.replaceAll(with: (0..<1_200).map { EventResponse.fixture(id: "e\($0)", name: "Concert \($0)") })
+
+        // Simulate rows stored before the search index existed
+        provider.driver.exec("DELETE FROM event_search")
+        #expect(provider.eventQueries.search("concert").isEmpty)
+
+        var reported: [MigrationProgress] = []
+        let subscription = provider.migrations.progress.sink { reported.append($0) }
+
+        // Launch is interrupted after two 500-row chunks
+        provider.migrations.runPending(maxChunks: 2)
+        let partial = provider.migrations.currentProgress(EventQueries.SearchIndexBackfill.migrationId)
+        #expect(partial.processed == 1_000)
+        #expect(partial.total == 1_200)
+        #expect(!partial.isComplete)
+
+        // Next launch: a fresh runner picks up from the persisted cursor
+        let relaunched = DatabaseProvider(path: path)
+        relaunched.migrations.runPending()
+        let finished = relaunched.migrations.currentProgress(EventQueries.SearchIndexBackfill.migrationId)
+        #expect(finished.isComplete)
+        #expect(finished.processed == 1_200)
+        #expect(finished.duration > 0)
+        #expect(relaunched.eventQueries.search("concert", limit: 2_000).count == 1_200)
+
+        #expect(reported.map(\.processed) == [500, 1_000])
+        subscription.cancel()
+    }
+
+    @Test func runRequestedWhileCancellingKeepsGoing() async throws {
+        let provider = DatabaseProvider(path: ":memory:")
+        let migration = GatedMigration()
+        let runner = MigrationRunner(driver: provider.driver, migrations: [migration])
+        let finished = DispatchSemaphore(value: 0)
+
+        runner.runInBackground { finished.signal() }
+        migration.firstChunkStarted.wait()
+
+        // Backgrounded mid-chunk, then foregrounded before the run has stopped
+        runner.cancel()
+        runner.runInBackground()
+        migration.releaseFirstChunk.signal()
+
+        #expect(finished.wait(timeout: .now() + 5) == .success)
+        #expect(runner.isComplete(migration.id))
+    }
+}
+
+/// Three one-unit chunks; the first blocks until the test releases it
+private struct GatedMigration: ChunkedMigration {
+    let id = "gated"
+    let chunkSize = 1
+    let firstChunkStarted = DispatchSemaphore(value: 0)
+    let releaseFirstChunk = DispatchSemaphore(value: 0)
+
+    func remainingUnits(on driver: RuntimeSqlDriver, after cursor: Int64) -> Int {
+        max(0, 3 - Int(cursor))
+    }
+
+    func migrateChunk(on driver: RuntimeSqlDriver, after cursor: Int64, limit: Int) -> (cursor: Int64, processed: Int)? {
+        guard cursor < 3 else { return nil }
+        if cursor == 0 {
+            firstChunkStarted.signal()
+            releaseFirstChunk.wait()
+        }
+        return (cursor + 1, 1)
+    }
+}
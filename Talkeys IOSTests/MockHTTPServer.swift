@@ -0,0 +1,102 @@
+//
+//  MockHTTPServer.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Network
+
+/// Minimal HTTP/1.1 keep-alive server on 127.0.0.1 that answers every GET with the same body.
+/// Counts accepted connections and requests so tests can see connection reuse and cache hits.
+final class MockHTTPServer {
+    private let listener: NWListener
+    private let queue = DispatchQueue(label: "MockHTTPServer")
+    private let response: Data
+    private let latency: TimeInterval
+    private let lock = NSLock()
+    private var acceptedConnections = 0
+    private var servedRequests = 0
+
+    init(body: Data, headers: [String: String] = [:], latency: TimeInterval = 0) throws {
+        var head = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: \(body.count)\r\nConnection: keep-alive\r\n"
+        headers.forEach { head += "\($0.key): \($0.value)\r\n" }
+        var response = Data((head + "\r\n").utf8)
+        response.append(body)
+        self.response = response
+        self.latency = latency
+        self.listener = try NWListener(using: .tcp, on: .any)
+    }
+
+    /// Start listening and return the base URL once the port is bound
+    func start() throws -> URL {
+        let ready = DispatchSemaphore(value: 0)
+        listener.stateUpdateHandler = { state in
+            if case .ready = state { ready.signal() }
+        }
+        listener.newConnectionHandler = { [weak self] connection in
+            self?.serve(connection)
+        }
+        listener.start(queue: queue)
+        guard ready.wait(timeout: .now() + 5) == .success, let port = listener.port?.rawValue else {
+            throw URLError(.cannotConnectToHost)
+        }
+        return URL(string: "http://127.0.0.1:\(port)/")!
+    }
+
+    func stop() {
+        listener.cancel()
+    }
+
+    var connections: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return acceptedConnections
+    }
+
+    var requests: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return servedRequests
+    }
+
+    // MARK: - Private Helpers
+
+    private func serve(_ connection: NWConnection) {
+        lock.lock()
+        acceptedConnections += 1
+        lock.unlock()
+        connection.start(queue: queue)
+        receive(on: connection, buffer: Data())
+    }
+
+    /// Requests carry no body, so each ends at the blank line after the headers
+    private func receive(on connection: NWConnection, buffer: Data) {
+        connection.receive(minimumIncompleteLength: 1, maximumLength: 64 * 1024) { [weak self] data, _, isComplete, error in
+            guard let self = self else { return }
+            var buffer = buffer
+            if let data = data {
+                buffer.append(data)
+            }
+
+            guard let end = buffer.range(of: Data("\r\n\r\n".utf8)) else {
+                if isComplete || error != nil {
+                    connection.cancel()
+                } else {
+                    self.receive(on: connection, buffer: buffer)
+                }
+                return
+            }
+
+            buffer.removeSubrange(..<end.upperBound)
+            self.lock.lock()
+            self.servedRequests += 1
+            self.lock.unlock()
+
+            self.queue.asyncAfter(deadline: .now() + self.latency) {
+                connection.send(content: self.response, completion: .contentProcessed { _ in
+                    self.receive(on: connection, buffer: buffer)
+                })
+            }
+        }
+    }
+}
@@ -0,0 +1,119 @@
+//
+//  QueryChangesTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+import sharedKit
+@testable import Talkeys_IOS
+
+struct QueryChangesTests {
+
+    @Test func eventStreamYieldsInitialValueThenCoalescedUpdates() async throws {
+        let provider = DatabaseProvider(path: ":memory:")
+        let queries = provider.eventQueries
+        let scheduler = ManualScheduler()
+        let fetches = FetchCount()
+        let stream = QueryChanges.stream(driver: provider.driver, tables: [EventQueries.tableKey], scheduler: scheduler) {
+            fetches.increment()
+            return queries.count()
+        }
+        var iterator = stream.makeAsyncIterator()
+
+        // The initial fetch opens a window, so this whole burst folds into one trailing re-query
+        #expect(await iterator.next() == 0)
+        for index in 0..<20 {
+            queries.upsert([.fixture(id: "e\(index)")])
+        }
+        await scheduler.closeNextWindow()
+        #expect(await iterator.next() == 20)
+        #expect(fetches.value == 2)
+
+        // Closing a quiet window re-queries nothing; the next write is delivered right away
+        await scheduler.closeNextWindow()
+        queries.upsert([.fixture(id: "e20")])
+        #expect(await iterator.next() == 21)
+        #expect(fetches.value == 3)
+    }
+
+    @Test func ownedStreamFinishesOnceItsOwnerIsGone() async throws {
+        let provider = DatabaseProvider(path: ":memory:")
+        let scheduler = ManualScheduler()
+        var owner: EventQueries? = EventQueries(driver: provider.driver)
+        let stream = QueryChanges.stream(driver: provider.driver, tables: [EventQueries.tableKey], owner: owner!, scheduler: scheduler) {
+            $0.count()
+        }
+        var iterator = stream.makeAsyncIterator()
+        #expect(await iterator.next() == 0)
+
+        owner = nil
+        provider.eventQueries.upsert([.fixture(id: "e1")])
+        await scheduler.closeNextWindow()
+        #expect(await iterator.next() == nil)
+    }
+
+    @Test func generatedQueryStreamFollowsUserRow() async throws {
+        let userQueries = DatabaseProvider(path: ":memory:").userQueries
+        let stream = QueryChanges.stream(of: userQueries.selectById(id: "u1", mapper: UserQueries.appUserMapper)) { query in
+            (query.executeAsOneOrNull() as? AppUser)?.name
+        }
+        var iterator = stream.makeAsyncIterator()
+
+        #expect(await iterator.next() == .some(nil))
+
+        userQueries.upsert([AppUser(id: "u1", name: "Asha", email: "asha@talkeys.xyz")])
+        #expect(await iterator.next() == "Asha")
+    }
+}
+
+/// Holds each coalescing window open until the test closes it
+private final class ManualScheduler: CoalescingScheduler, @unchecked Sendable {
+    private let lock = NSLock()
+    private var pending: [() -> Void] = []
+    private var waiters: [CheckedContinuation<Void, Never>] = []
+
+    func schedule(after interval: TimeInterval, _ body: @escaping () -> Void) {
+        lock.lock()
+        pending.append(body)
+        let ready = waiters
+        waiters.removeAll()
+        lock.unlock()
+        ready.forEach { $0.resume() }
+    }
+
+    /// Waits for the listener to open a window, then closes it
+    func closeNextWindow() async {
+        await withCheckedContinuation { (continuation: CheckedContinuation<Void, Never>) in
+            lock.lock()
+            if pending.isEmpty {
+                waiters.append(continuation)
+                lock.unlock()
+            } else {
+                lock.unlock()
+                continuation.resume()
+            }
+        }
+        lock.lock()
+        let close = pending.removeFirst()
+        lock.unlock()
+        close()
+    }
+}
+
+private final class FetchCount: @unchecked Sendable {
+    private let lock = NSLock()
+    private var count = 0
+
+    var value: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return count
+    }
+
+    func increment() {
+        lock.lock()
+        count += 1
+        lock.unlock()
+    }
+}
@@ -0,0 +1,56 @@
+//
+//  SQLiteDriverBenchmarks.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+@testable import Talkeys_IOS
+
+/// Read latency while a bulk write is running, pooled WAL vs. single default connection.
+/// Run with RUN_BENCHMARKS=1 in the test scheme.
+@Suite(.enabled(if: ProcessInfo.processInfo.environment["RUN_BENCHMARKS"] != nil))
+struct SQLiteDriverBenchmarks {
+
+    private func readLatencies(configuration: SQLiteConfiguration) -> [Double] {
+        let path = FileManager.default.temporaryDirectory.appendingPathComponent("concurrency-\(UUID().uuidString).db").path
+        let queries = DatabaseProvider(path: path, configuration: configuration).eventQueries
+        queries.replaceAll(with: (0..<1_000).map { EventResponse.fixture(id: "seed-\($0)", isLive: $0 % 2 == 0) })
+
+        let writes = (0..<20).map { batch in (0..<2_000).map { EventResponse.fixture(id: "bulk-\(batch)-\($0)") } }
+        let writerDone = DispatchSemaphore(value: 0)
+        DispatchQueue.global(qos: .utility).async {
+            writes.forEach { queries.upsert($0) }
+            writerDone.signal()
+        }
+
+        let lock = NSLock()
+        var latencies: [Double] = []
+        DispatchQueue.concurrentPerform(iterations: 4) { _ in
+            for _ in 0..<50 {
+                let start = CFAbsoluteTimeGetCurrent()
+                _ = queries.selectLive()
+                let elapsed = (CFAbsoluteTimeGetCurrent() - start) * 1000
+                lock.lock()
+                latencies.append(elapsed)
+                lock.unlock()
+            }
+        }
+        writerDone.wait()
+        return latencies.sorted()
+    }
+
+    private func percentile(_ sorted: [Double], _ p: Double) -> Double {
+        sorted[min(sorted.count - 1, Int(Double(sorted.count) * p))]
+    }
+
+    @Test func readsDuringBulkWrites() async throws {
+        let pooled = readLatencies(configuration: .default)
+        let unpooled = readLatencies(configuration: .unpooled)
+
+        for (name, latencies) in [("WAL + readers", pooled), ("default, 1 connection", unpooled)] {
+            print("🧵 \(name) — read p50: \(String(format: "%.2f", percentile(latencies, 0.5))) ms, p95: \(String(format: "%.2f", percentile(latencies, 0.95))) ms, max: \(String(format: "%.2f", latencies.last ?? 0)) ms")
+        }
+        #expect(percentile(pooled, 0.95) <= percentile(unpooled, 0.95))
+    }
+}
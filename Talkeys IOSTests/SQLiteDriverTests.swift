@@ -0,0 +1,132 @@
+//
+//  SQLiteDriverTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+@testable import Talkeys_IOS
+import sharedKit
+
+struct SQLiteDriverTests {
+
+    private func temporaryPath() -> String {
+        FileManager.default.temporaryDirectory.appendingPathComponent("driver-\(UUID().uuidString).db").path
+    }
+
+    @Test func fileDatabaseUsesWALAndReaderPool() async throws {
+        let provider = DatabaseProvider(path: temporaryPath())
+        #expect(provider.driver.journalMode.lowercased() == "wal")
+        #expect(provider.driver.readerCount == SQLiteConfiguration.default.readerCount)
+
+        let memory = DatabaseProvider(path: ":memory:")
+        #expect(memory.driver.readerCount == 0)
+    }
+
+    @Test func readsSeeLastCommitWhileWriteTransactionIsOpen() async throws {
+        let provider = DatabaseProvider(path: temporaryPath())
+        let queries = provider.eventQueries
+        queries.replaceAll(with: [.fixture(id: "committed")])
+
+        let readFinished = DispatchSemaphore(value: 0)
+        let seen = SeenIDs()
+
+        provider.driver.transaction {
+            queries.upsert([.fixture(id: "pending")])
+            #expect(queries.count() == 2)
+
+            // Another thread reads from the pool without waiting for this transaction
+            DispatchQueue.global().async {
+                seen.ids = queries.selectAll().map(\.id)
+                readFinished.signal()
+            }
+            #expect(readFinished.wait(timeout: .now() + 2) == .success)
+        }
+
+        #expect(seen.ids == ["committed"])
+        #expect(queries.count() == 2)
+    }
+
+    @Test func overlappingWriteTransactionsRunOneAfterTheOther() async throws {
+        let provider = DatabaseProvider(path: temporaryPath())
+        let driver = provider.driver
+        let queries = provider.eventQueries
+        let log = TransactionLog()
+        let firstStarted = DispatchSemaphore(value: 0)
+        let secondWaiting = DispatchSemaphore(value: 0)
+        let bothFinished = DispatchGroup()
+
+        DispatchQueue.global().async(group: bothFinished) {
+            try? driver.transaction {
+                log.append("first-begin")
+                queries.upsert([.fixture(id: "rolled-back")])
+                firstStarted.signal()
+                // Stay open until the second thread is about to ask for its own transaction
+                secondWaiting.wait()
+                log.append("first-end")
+                throw RollbackRequested()
+            }
+        }
+        DispatchQueue.global().async(group: bothFinished) {
+            firstStarted.wait()
+            secondWaiting.signal()
+            driver.transaction {
+                log.append("second-begin")
+                queries.upsert([.fixture(id: "committed")])
+                log.append("second-end")
+            }
+        }
+
+        #expect(bothFinished.wait(timeout: .now() + 5) == .success)
+        #expect(log.entries == ["first-begin", "first-end", "second-begin", "second-end"])
+        #expect(queries.selectAll().map(\.id) == ["committed"])
+        #expect(driver.currentTransaction() == nil)
+    }
+
+    @Test func failedStatementReportsNoChangesAndRollsBackItsTransaction() async throws {
+        let provider = DatabaseProvider(path: temporaryPath())
+        let driver = provider.driver
+        let queries = provider.eventQueries
+        queries.replaceAll(with: [.fixture(id: "kept")])
+
+        // A failed statement reports 0, not the previous statement's change count
+        let failed = driver.execute(identifier: nil, sql: "UPDATE no_such_table SET id = 1", parameters: 0, binders: nil)
+        #expect((failed.value as? KotlinLong)?.intValue == 0)
+        #expect(driver.lastError != nil)
+
+        #expect(throws: SQLiteError.self) {
+            try driver.checkedTransaction {
+                queries.upsert([.fixture(id: "discarded")])
+                _ = driver.execute(identifier: nil, sql: "INSERT INTO no_such_table VALUES (1)", parameters: 0, binders: nil)
+            }
+        }
+
+        #expect(queries.selectAll().map(\.id) == ["kept"])
+        #expect(driver.currentTransaction() == nil)
+    }
+}
+
+/// Written by the background reader, read after the semaphore signals
+private final class SeenIDs: @unchecked Sendable {
+    var ids: [String] = []
+}
+
+/// Records transaction steps from both writer threads in the order they happen
+private final class TransactionLog: @unchecked Sendable {
+    private let lock = NSLock()
+    private var storage: [String] = []
+
+    func append(_ entry: String) {
+        lock.lock()
+        defer { lock.unlock() }
+        storage.append(entry)
+    }
+
+    var entries: [String] {
+        lock.lock()
+        defer { lock.unlock() }
+        return storage
+    }
+}
+
+private struct RollbackRequested: Error {}
@@ -0,0 +1,112 @@
+//
+//  SignInPipelineTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+@testable import Talkeys_IOS
+
+struct SignInPipelineTests {
+
+    private let user = AppUser(id: "u1", name: "Ada", email: "ada@example.com", profilePicture: "https://example.com/ada.png")
+
+    @Test func tokenAndPersistOverlap() async throws {
+        let tokenStarted = Gate()
+        let persistStarted = Gate()
+        // Each stage waits for the other to start, so run one after another they would never finish
+        let pipeline = SignInPipeline(stages: .init(
+            exchangeToken: { _ in
+                await tokenStarted.open()
+                await persistStarted.wait()
+            },
+            persistUser: { _ in
+                await persistStarted.open()
+                await tokenStarted.wait()
+            },
+            prefetchImage: { _ in }
+        ))
+
+        let report = try await pipeline.run(idToken: "token", user: user)
+
+        #expect(report.user == user)
+        #expect(Set(report.durations.keys) == [.tokenExchange, .persistUser])
+        #expect(report.failures.isEmpty)
+    }
+
+    @Test func returnsWithoutWaitingForImagePrefetch() async throws {
+        let releasePrefetch = Gate()
+        let pipeline = SignInPipeline(stages: .init(
+            exchangeToken: { _ in },
+            persistUser: { _ in },
+            prefetchImage: { _ in await releasePrefetch.wait() }
+        ))
+
+        // The prefetch is still blocked here, so returning at all shows run doesn't wait on it
+        let report = try await pipeline.run(idToken: "token", user: user)
+        #expect(report.durations[.prefetchImage] == nil)
+
+        await releasePrefetch.open()
+        let prefetchError = await report.imagePrefetch.value
+        #expect(prefetchError == nil)
+    }
+
+    @Test func prefetchFailureDoesNotFailSignIn() async throws {
+        struct Offline: Error {}
+        let pipeline = SignInPipeline(stages: .init(
+            exchangeToken: { _ in },
+            persistUser: { _ in },
+            prefetchImage: { _ in throw Offline() }
+        ))
+
+        let report = try await pipeline.run(idToken: "token", user: user)
+
+        #expect(await report.imagePrefetch.value is Offline)
+        #expect(report.failures.isEmpty)
+    }
+
+    @Test func tokenExchangeFailureFailsSignIn() async throws {
+        struct Rejected: Error {}
+        let pipeline = SignInPipeline(stages: .init(
+            exchangeToken: { _ in throw Rejected() },
+            persistUser: { _ in },
+            prefetchImage: { _ in }
+        ))
+
+        await #expect(throws: Rejected.self) {
+            try await pipeline.run(idToken: "token", user: user)
+        }
+    }
+
+    @Test func stagesMarkTheTrace() async throws {
+        let trace = AuthFlowTrace("pipelineTest")
+        let pipeline = SignInPipeline(stages: .init(
+            exchangeToken: { _ in },
+            persistUser: { _ in },
+            prefetchImage: { _ in }
+        ))
+
+        let report = try await pipeline.run(idToken: "token", user: AppUser(id: "u2", name: "Bo", email: ""), trace: trace)
+        _ = await report.imagePrefetch.value
+
+        let names = Set(trace.steps.map(\.name))
+        #expect(names.isSuperset(of: SignInPipeline.Stage.allCases.map(\.rawValue)))
+    }
+}
+
+/// One-shot signal a stage can wait on without sleeping
+private actor Gate {
+    private var isOpen = false
+    private var waiters: [CheckedContinuation<Void, Never>] = []
+
+    func open() {
+        isOpen = true
+        waiters.forEach { $0.resume() }
+        waiters.removeAll()
+    }
+
+    func wait() async {
+        guard !isOpen else { return }
+        await withCheckedContinuation { waiters.append($0) }
+    }
+}
@@ -0,0 +1,62 @@
+//
+//  StartupOrchestratorTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+@testable import Talkeys_IOS
+
+struct StartupOrchestratorTests {
+
+    @Test func databaseOpensAfterTheFirstFrame() async throws {
+        let container = AppContainer()
+        let orchestrator = StartupOrchestrator()
+        orchestrator.registerAppStages(container: container)
+
+        #expect(orchestrator.stageNames(.critical) == ["TokenPreload", "BackgroundRefreshRegistration"])
+        let deferred = orchestrator.stageNames(.deferred)
+        #expect(deferred.first == "LocalDatabaseOpen")
+        #expect(deferred.firstIndex(of: "LocalDatabaseOpen")! < deferred.firstIndex(of: "DatabaseMigrations")!)
+
+        orchestrator.runCriticalPath()
+
+        #expect(orchestrator.timings.map(\.name) == ["TokenPreload", "BackgroundRefreshRegistration"])
+        #expect(container.instanceCount(of: AppContainer.Definition.databaseProvider.rawValue) == 0)
+        #expect(container.instanceCount(of: AppContainer.Definition.userProfileStore.rawValue) == 0)
+    }
+
+    @Test func deferredStagesRunOnlyAfterFirstFrame() async throws {
+        let orchestrator = StartupOrchestrator()
+        let executed = StageLog()
+        orchestrator.register("Critical", priority: .critical) { executed.append("Critical") }
+        orchestrator.register("Deferred", priority: .deferred) { executed.append("Deferred") }
+
+        orchestrator.runCriticalPath()
+        #expect(executed.entries == ["Critical"])
+
+        await withCheckedContinuation { continuation in
+            orchestrator.runDeferredStages { continuation.resume() }
+        }
+        #expect(executed.entries == ["Critical", "Deferred"])
+        #expect(orchestrator.timings.map(\.name) == ["Critical", "Deferred"])
+    }
+}
+
+/// Appended to from the main thread and the deferred queue
+private final class StageLog: @unchecked Sendable {
+    private let lock = NSLock()
+    private var storage: [String] = []
+
+    func append(_ entry: String) {
+        lock.lock()
+        defer { lock.unlock() }
+        storage.append(entry)
+    }
+
+    var entries: [String] {
+        lock.lock()
+        defer { lock.unlock() }
+        return storage
+    }
+}
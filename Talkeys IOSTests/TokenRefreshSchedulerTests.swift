@@ -0,0 +1,58 @@
+//
+//  TokenRefreshSchedulerTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+@testable import Talkeys_IOS
+
+struct TokenRefreshSchedulerTests {
+
+    private final class CountingRefresher {
+        private let lock = NSLock()
+        private(set) var calls = 0
+
+        func refresh() async throws -> String {
+            lock.lock()
+            calls += 1
+            lock.unlock()
+            try await Task.sleep(nanoseconds: 50_000_000)
+            return "refreshed-token"
+        }
+    }
+
+    @Test func concurrentRefreshesAreCoalesced() async throws {
+        let refresher = CountingRefresher()
+        let vault = TokenVault(service: "TokenRefreshSchedulerTests.\(UUID().uuidString)")
+        let scheduler = TokenRefreshScheduler(vault: vault, refresher: refresher.refresh)
+
+        let tokens = try await withThrowingTaskGroup(of: String.self) { group in
+            for _ in 0..<5 {
+                group.addTask { try await scheduler.refreshNow() }
+            }
+            return try await group.reduce(into: [String]()) { $0.append($1) }
+        }
+
+        #expect(tokens == Array(repeating: "refreshed-token", count: 5))
+        #expect(refresher.calls == 1)
+        #expect(vault.currentToken == "refreshed-token")
+        _ = vault.clear()
+    }
+
+    @Test func unauthorizedRequestIsRetriedWithRefreshedToken() async throws {
+        let refresher = CountingRefresher()
+        let vault = TokenVault(service: "TokenRefreshSchedulerTests.\(UUID().uuidString)")
+        _ = vault.save("stale-token")
+        let scheduler = TokenRefreshScheduler(vault: vault, refresher: refresher.refresh)
+
+        let usedToken: String? = try await scheduler.performAuthorized { token in
+            guard token == "refreshed-token" else { throw APIError.unauthorized }
+            return token
+        }
+
+        #expect(usedToken == "refreshed-token")
+        #expect(refresher.calls == 1)
+        _ = vault.clear()
+    }
+}
@@ -0,0 +1,60 @@
+//
+//  TokenVaultTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Combine
+import Testing
+@testable import Talkeys_IOS
+
+struct TokenVaultTests {
+
+    private func makeJWT(exp: TimeInterval) -> String {
+        let payload = try! JSONSerialization.data(withJSONObject: ["sub": "123", "exp": exp])
+        let encoded = payload.base64EncodedString()
+            .replacingOccurrences(of: "+", with: "-")
+            .replacingOccurrences(of: "/", with: "_")
+            .replacingOccurrences(of: "=", with: "")
+        return "eyJhbGciOiJSUzI1NiJ9.\(encoded).signature"
+    }
+
+    @Test func expiryIsParsedFromJWT() async throws {
+        let exp = Date().addingTimeInterval(3600).timeIntervalSince1970.rounded()
+        #expect(TokenVault.expiry(ofJWT: makeJWT(exp: exp))?.timeIntervalSince1970 == exp)
+        #expect(TokenVault.expiry(ofJWT: "opaque-token") == nil)
+    }
+
+    @Test func saveAndClearUpdateMemoryAndNotify() async throws {
+        let vault = TokenVault(service: "TokenVaultTests.\(UUID().uuidString)")
+        var received: [String?] = []
+        let subscription = vault.tokenDidChange.sink { received.append($0) }
+        defer { subscription.cancel() }
+
+        let expired = makeJWT(exp: Date().addingTimeInterval(-60).timeIntervalSince1970)
+        _ = vault.save(expired)
+        #expect(vault.currentToken == expired)
+        #expect(vault.validToken == nil)
+
+        _ = vault.clear()
+        #expect(vault.currentToken == nil)
+        #expect(received == [expired, nil])
+    }
+
+    @Test func legacyTokenMigratesWithoutNotifying() async throws {
+        let defaults = try #require(UserDefaults(suiteName: "TokenVaultTests.\(UUID().uuidString)"))
+        let expiry = Date().addingTimeInterval(3600).timeIntervalSince1970.rounded()
+        defaults.set("opaque-legacy-token", forKey: "auth_token")
+        defaults.set(expiry, forKey: "auth_token_expiry")
+
+        let vault = TokenVault(service: "TokenVaultTests.\(UUID().uuidString)", defaults: defaults)
+        var received: [String?] = []
+        let subscription = vault.tokenDidChange.sink { received.append($0) }
+        defer { subscription.cancel() }
+
+        #expect(vault.currentToken == "opaque-legacy-token")
+        #expect(vault.expiryDate?.timeIntervalSince1970 == expiry)
+        #expect(received.isEmpty)
+        #expect(defaults.string(forKey: "auth_token") == nil)
+    }
+}
@@ -0,0 +1,57 @@
+//
+//  UserProfileStoreTests.swift
+//  Talkeys IOSTests
+//
+
+import Foundation
+import Testing
+import sharedKit
+@testable import Talkeys_IOS
+
+struct UserProfileStoreTests {
+
+    private func makeStore() -> UserProfileStore {
+        let provider = DatabaseProvider(path: ":memory:")
+        let defaults = UserDefaults(suiteName: "UserProfileStoreTests.\(UUID().uuidString)")!
+        return UserProfileStore(queries: provider.userQueries, defaults: defaults)
+    }
+
+    @Test func savedUserIsRestoredFromLocalDatabase() async throws {
+        let store = makeStore()
+        #expect(store.cachedUser() == nil)
+
+        store.save(AppUser(id: "u1", name: "Asha", email: "asha@talkeys.xyz"))
+        store.save(AppUser(id: "u1", name: "Asha K", email: "asha@talkeys.xyz", profilePicture: "https://example.com/a.png"))
+
+        let restored = try #require(store.cachedUser())
+        #expect(restored.name == "Asha K")
+        #expect(restored.profilePicture == "https://example.com/a.png")
+        #expect(restored.createdAt != nil)
+
+        // Not persisted by the generated table; documented on `cachedUser()`
+        store.save(AppUser(id: "u1", name: "Asha K", email: "asha@talkeys.xyz", displayName: "AK", about: "Poet", pronouns: "she/her"))
+        let partial = try #require(store.cachedUser())
+        #expect(partial.displayName == "Asha K")
+        #expect(partial.about == nil)
+        #expect(partial.pronouns == nil)
+
+        store.clear()
+        #expect(store.cachedUser() == nil)
+    }
+
+    @Test func mapperBuildsAppUserFromRowAndAuthUser() async throws {
+        let queries = DatabaseProvider(path: ":memory:").userQueries
+        queries.insertUser(id: "u1", name: "Asha", email: "asha@talkeys.xyz", profilePicture: nil, createdAt: "2025-01-01")
+        queries.insertUser(id: "u2", name: "Ravi", email: "ravi@talkeys.xyz", profilePicture: "https://example.com/r.png", createdAt: "2025-02-01")
+
+        #expect(queries.selectAppUser(id: "u1") == AppUser(id: "u1", name: "Asha", email: "asha@talkeys.xyz", createdAt: "2025-01-01"))
+        #expect(queries.selectAppUser(id: "missing") == nil)
+        #expect(queries.selectAllAppUsers().map(\.id).sorted() == ["u1", "u2"])
+
+        let authUser = User(id: "u3", name: "Mira", email: "mira@talkeys.xyz", displayName: nil, profilePicture: nil, about: "Poet", pronouns: "she/her")
+        let converted = AppUser(authUser)
+        #expect(converted.displayName == "Mira")
+        #expect(converted.about == "Poet")
+        #expect(converted.pronouns == "she/her")
+    }
+}
@@ -0,0 +1,36 @@
+#!/bin/sh
+# Report sharedKit's exported Objective-C surface and binary size.
+# Usage: scripts/sharedkit-surface.sh [path/to/sharedKit.xcframework]
+# Run before and after changing the KMP export policy and record both in SHAREDKIT_EXPORT_POLICY.md.
+
+set -eu
+
+XCFRAMEWORK="${1:-release/sharedKit.xcframework}"
+SLICE="$XCFRAMEWORK/ios-arm64/sharedKit.framework"
+HEADER="$SLICE/Headers/sharedKit.h"
+
+if [ ! -f "$HEADER" ]; then
+    echo "No header at $HEADER" >&2
+    exit 1
+fi
+
+echo "sharedKit surface ($SLICE)"
+echo "  header lines:        $(wc -l < "$HEADER" | tr -d ' ')"
+echo "  exported classes:    $(grep -c '^@interface' "$HEADER")"
+echo "  exported protocols:  $(grep -cE '^@protocol SharedKit[A-Za-z_]+( <.*>)?$' "$HEADER")"
+
+echo "  declarations by group:"
+grep -oE '^@(interface|protocol) SharedKit[A-Za-z]+' "$HEADER" \
+    | sed -E 's/^@(interface|protocol) SharedKit//' \
+    | sed -E 's/^(Ktor|Koin|Kotlinx|Kotlin|Runtime).*/\1/; t; s/.*/App/' \
+    | sort | uniq -c | sort -rn \
+    | while read -r count group; do printf '    %-10s %s\n' "$group" "$count"; done
+
+if [ -f "$SLICE/sharedKit" ]; then
+    echo "  binary size (arm64): $(du -k "$SLICE/sharedKit" | cut -f1) KiB"
+    if command -v xcrun >/dev/null 2>&1; then
+        echo "  exported symbols:    $(xcrun nm -gU "$SLICE/sharedKit" | wc -l | tr -d ' ')"
+    fi
+else
+    echo "  binary size (arm64): binary not present in this checkout"
+fi